@@ -51,7 +51,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
-	bool exists = files.has(pmd5);
+	bool exists = files.has(pmd5) || _find_indexed(pmd5) != -1;
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
@@ -68,39 +68,50 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	}
 
 	if (!exists) {
-		// Search for directory.
-		PackedDir *cd = root;
-
-		if (simplified_path.contains_char('/')) { // In a subdirectory.
-			Vector<String> ds = simplified_path.get_base_dir().split("/");
-
-			for (int j = 0; j < ds.size(); j++) {
-				if (!cd->subdirs.has(ds[j])) {
-					PackedDir *pd = memnew(PackedDir);
-					pd->name = ds[j];
-					pd->parent = cd;
-					cd->subdirs[pd->name] = pd;
-					cd = pd;
-				} else {
-					cd = cd->subdirs[ds[j]];
-				}
+		_add_dir_path(simplified_path);
+	}
+}
+
+void PackedData::_add_dir_path(const String &p_simplified_path) {
+	// Search for directory.
+	PackedDir *cd = root;
+
+	if (p_simplified_path.contains_char('/')) { // In a subdirectory.
+		Vector<String> ds = p_simplified_path.get_base_dir().split("/");
+
+		for (int j = 0; j < ds.size(); j++) {
+			if (!cd->subdirs.has(ds[j])) {
+				PackedDir *pd = memnew(PackedDir);
+				pd->name = ds[j];
+				pd->parent = cd;
+				cd->subdirs[pd->name] = pd;
+				cd = pd;
+			} else {
+				cd = cd->subdirs[ds[j]];
 			}
 		}
-		String filename = simplified_path.get_file();
-		// Don't add as a file if the path points to a directory.
-		if (!filename.is_empty()) {
-			cd->files.insert(filename);
-		}
+	}
+	String filename = p_simplified_path.get_file();
+	// Don't add as a file if the path points to a directory.
+	if (!filename.is_empty()) {
+		cd->files.insert(filename);
 	}
 }
 
 void PackedData::remove_path(const String &p_path) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
-	if (!files.has(pmd5)) {
+	bool in_files = files.has(pmd5);
+	bool in_index = _find_indexed(pmd5) != -1;
+	if (!in_files && !in_index) {
 		return;
 	}
 
+	files.erase(pmd5);
+	if (in_index) {
+		indexed_pack.removed.insert(pmd5);
+	}
+
 	// Search for directory.
 	PackedDir *cd = root;
 
@@ -117,8 +128,73 @@ void PackedData::remove_path(const String &p_path) {
 	}
 
 	cd->files.erase(simplified_path.get_file());
+}
 
-	files.erase(pmd5);
+bool PackedData::add_path_index(const String &p_pkg_path, const Vector<uint8_t> &p_index, uint64_t p_file_base, PackSource *p_src) {
+	// Only the first pack can be queried in place, packs layered on top of it need
+	// the replace/removal semantics of `files` and are mounted from their directory.
+	if (indexed_pack.index.is_valid() || !files.is_empty()) {
+		return false;
+	}
+
+	if (indexed_pack.index.load(p_index) != OK) {
+		indexed_pack.index.clear();
+		return false;
+	}
+
+	indexed_pack.pack = p_pkg_path;
+	indexed_pack.src = p_src;
+	indexed_pack.file_base = p_file_base;
+	indexed_pack.removed.clear();
+	indexed_pack.dirs_built.clear();
+
+	return true;
+}
+
+int64_t PackedData::_find_indexed(const PathMD5 &p_md5) const {
+	if (!indexed_pack.index.is_valid() || indexed_pack.removed.has(p_md5)) {
+		return -1;
+	}
+
+	uint8_t key[16];
+	p_md5.get_bytes(key);
+	return indexed_pack.index.find(key);
+}
+
+bool PackedData::_get_indexed_file(const PathMD5 &p_md5, PackedFile &r_file) const {
+	int64_t idx = _find_indexed(p_md5);
+	if (idx == -1) {
+		return false;
+	}
+
+	PackPathIndex::Entry entry = indexed_pack.index.get_entry(idx);
+	r_file.pack = indexed_pack.pack;
+	r_file.offset = indexed_pack.file_base + entry.ofs;
+	r_file.size = entry.size;
+	memcpy(r_file.md5, entry.md5, 16);
+	r_file.src = indexed_pack.src;
+	r_file.encrypted = entry.flags & PACK_FILE_ENCRYPTED;
+	return true;
+}
+
+PackedData::PackedDir *PackedData::_get_root_dir() {
+	// The directory tree of an indexed pack is only built once something browses it.
+	if (indexed_pack.index.is_valid() && !indexed_pack.dirs_built.is_set()) {
+		MutexLock lock(indexed_pack.dirs_mutex);
+		if (!indexed_pack.dirs_built.is_set()) {
+			for (uint32_t i = 0; i < indexed_pack.index.get_entry_count(); i++) {
+				const uint8_t *path_md5 = indexed_pack.index.get_entry(i).path_md5;
+				PathMD5 pmd5;
+				memcpy(&pmd5.a, path_md5, 8);
+				memcpy(&pmd5.b, path_md5 + 8, 8);
+				if (!indexed_pack.removed.has(pmd5)) {
+					_add_dir_path(indexed_pack.index.get_entry_path(i));
+				}
+			}
+			indexed_pack.dirs_built.set();
+		}
+	}
+	return root;
 }
 
 void PackedData::add_pack_source(PackSource *p_source) {
@@ -132,15 +208,20 @@ uint8_t *PackedData::get_file_hash(const String &p_path) {
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
 	if (!E) {
-		return nullptr;
+		int64_t idx = _find_indexed(pmd5);
+		if (idx == -1) {
+			return nullptr;
+		}
+		return const_cast<uint8_t *>(indexed_pack.index.get_entry(idx).md5);
 	}
 
 	return E->value.md5;
 }
 
-HashSet<String> PackedData::get_file_paths() const {
+HashSet<String> PackedData::get_file_paths() {
 	HashSet<String> file_paths;
-	_get_file_paths(root, root->name, file_paths);
+	PackedDir *root_dir = _get_root_dir();
+	_get_file_paths(root_dir, root_dir->name, file_paths);
 	return file_paths;
 }
 
@@ -156,6 +237,11 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 
 void PackedData::clear() {
 	files.clear();
+	indexed_pack.index.clear();
+	indexed_pack.pack = String();
+	indexed_pack.src = nullptr;
+	indexed_pack.removed.clear();
+	indexed_pack.dirs_built.clear();
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -272,7 +358,9 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	bool enc_directory = (pack_flags & PACK_DIR_ENCRYPTED);
 	bool rel_filebase = (pack_flags & PACK_REL_FILEBASE);
 
-	for (int i = 0; i < 16; i++) {
+	uint64_t index_ofs = f->get_64();
+	uint64_t index_size = f->get_64();
+	for (int i = 0; i < 12; i++) {
 		//reserved
 		f->get_32();
 	}
@@ -281,6 +369,24 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 
 	if (rel_filebase) {
 		file_base += pck_start_pos;
+		index_ofs += pck_start_pos;
+	}
+
+	if ((pack_flags & PACK_PATH_INDEX) && !enc_directory && index_size > 0) {
+		// Mount straight from the prebuilt index, skipping the directory entirely.
+		const uint64_t pack_length = f->get_length();
+		if (p_offset > pack_length || index_ofs > pack_length - p_offset || index_size > pack_length - p_offset - index_ofs) {
+			WARN_PRINT(vformat("Path index of pack \"%s\" is out of bounds, loading its directory instead.", p_path));
+		} else {
+			uint64_t dir_pos = f->get_position();
+			Vector<uint8_t> index;
+			index.resize(index_size);
+			f->seek(index_ofs + p_offset);
+			if (f->get_buffer(index.ptrw(), index_size) == index_size && PackedData::get_singleton()->add_path_index(p_path, index, file_base + p_offset, this)) {
+				return true;
+			}
+			f->seek(dir_pos);
+		}
 	}
 
 	if (enc_directory) {
@@ -577,7 +683,7 @@ PackedData::PackedDir *DirAccessPack::_find_dir(const String &p_dir) {
 	PackedData::PackedDir *pd;
 
 	if (absolute) {
-		pd = PackedData::get_singleton()->root;
+		pd = PackedData::get_singleton()->_get_root_dir();
 	} else {
 		pd = current;
 	}
@@ -656,5 +762,5 @@ String DirAccessPack::get_filesystem_type() const {
 }
 
 DirAccessPack::DirAccessPack() {
-	current = PackedData::get_singleton()->root;
+	current = PackedData::get_singleton()->_get_root_dir();
 }
@@ -34,9 +34,12 @@
 
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/pack_path_index.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/safe_refcount.h"
 
 // Redot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -46,6 +49,7 @@
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
 	PACK_REL_FILEBASE = 1 << 1,
+	PACK_PATH_INDEX = 1 << 2, // A PackPathIndex follows the directory, its offset and size are stored in the first reserved header fields.
 };
 
 enum PackFileFlags {
@@ -96,10 +100,31 @@ private:
 			a = *((uint64_t *)&p_buf[0]);
 			b = *((uint64_t *)&p_buf[8]);
 		}
+
+		void get_bytes(uint8_t *r_buf) const {
+			memcpy(r_buf, &a, 8);
+			memcpy(r_buf + 8, &b, 8);
+		}
 	};
 
 	HashMap<PathMD5, PackedFile, PathMD5> files;
 
+	// Pack mounted through its prebuilt path index. Its files are resolved from the
+	// index on lookup instead of being inserted into `files`, which only holds what
+	// later packs added on top of it.
+	struct IndexedPack {
+		PackPathIndex index;
+		String pack;
+		PackSource *src = nullptr;
+		uint64_t file_base = 0;
+		HashSet<PathMD5, PathMD5> removed;
+		// Directories are built on first browse, which can happen from loader threads.
+		SafeFlag dirs_built;
+		BinaryMutex dirs_mutex;
+	};
+
+	IndexedPack indexed_pack;
+
 	Vector<PackSource *> sources;
 
 	PackedDir *root = nullptr;
@@ -109,13 +134,19 @@ private:
 
 	void _free_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
+	void _add_dir_path(const String &p_simplified_path);
+
+	int64_t _find_indexed(const PathMD5 &p_md5) const;
+	bool _get_indexed_file(const PathMD5 &p_md5, PackedFile &r_file) const;
+	PackedDir *_get_root_dir();
 
 public:
 	void add_pack_source(PackSource *p_source);
 	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false); // for PackSource
 	void remove_path(const String &p_path);
+	bool add_path_index(const String &p_pkg_path, const Vector<uint8_t> &p_index, uint64_t p_file_base, PackSource *p_src); // for PackSource
 	uint8_t *get_file_hash(const String &p_path);
-	HashSet<String> get_file_paths() const;
+	HashSet<String> get_file_paths();
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -211,7 +242,11 @@ int64_t PackedData::get_size(const String &p_path) {
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
 	if (!E) {
-		return -1; // File not found.
+		PackedFile pf;
+		if (!_get_indexed_file(pmd5, pf)) {
+			return -1; // File not found.
+		}
+		return pf.size;
 	}
 	if (E->value.offset == 0) {
 		return -1; // File was erased.
@@ -223,15 +258,20 @@ Ref<FileAccess> PackedData::try_open_path(const String &p_path) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
-	if (!E) {
-		return nullptr; // Not found.
+	if (E) {
+		return E->value.src->get_file(p_path, &E->value);
 	}
 
-	return E->value.src->get_file(p_path, &E->value);
+	PackedFile pf;
+	if (!_get_indexed_file(pmd5, pf)) {
+		return nullptr; // Not found.
+	}
+	return pf.src->get_file(p_path, &pf);
 }
 
 bool PackedData::has_path(const String &p_path) {
-	return files.has(PathMD5(p_path.simplify_path().trim_prefix("res://").md5_buffer()));
+	PathMD5 pmd5(p_path.simplify_path().trim_prefix("res://").md5_buffer());
+	return files.has(pmd5) || _find_indexed(pmd5) != -1;
 }
 
 bool PackedData::has_directory(const String &p_path) {
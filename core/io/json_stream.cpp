@@ -0,0 +1,1103 @@
+/**************************************************************************/
+/*  json_stream.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "json_stream.h"
+
+const char *JSONStreamReader::tk_name[TK_MAX] = {
+	"'{'",
+	"'}'",
+	"'['",
+	"']'",
+	"identifier",
+	"string",
+	"number",
+	"':'",
+	"','",
+};
+
+static _FORCE_INLINE_ bool _is_number_char(uint8_t p_char) {
+	return is_digit(p_char) || p_char == '-' || p_char == '+' || p_char == '.' || p_char == 'e' || p_char == 'E';
+}
+
+static _FORCE_INLINE_ bool _parse_hex4(const uint8_t *p_str, char32_t &r_value) {
+	r_value = 0;
+	for (int i = 0; i < 4; i++) {
+		uint8_t c = p_str[i];
+		char32_t v;
+		if (is_digit(c)) {
+			v = c - '0';
+		} else if (c >= 'a' && c <= 'f') {
+			v = c - 'a' + 10;
+		} else if (c >= 'A' && c <= 'F') {
+			v = c - 'A' + 10;
+		} else {
+			return false;
+		}
+		r_value = (r_value << 4) | v;
+	}
+	return true;
+}
+
+static _FORCE_INLINE_ void _append_utf8(LocalVector<char> &r_text, char32_t p_char) {
+	if (p_char < 0x80) {
+		r_text.push_back(p_char);
+	} else if (p_char < 0x800) {
+		r_text.push_back(0xC0 | (p_char >> 6));
+		r_text.push_back(0x80 | (p_char & 0x3F));
+	} else if (p_char < 0x10000) {
+		r_text.push_back(0xE0 | (p_char >> 12));
+		r_text.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_text.push_back(0x80 | (p_char & 0x3F));
+	} else {
+		r_text.push_back(0xF0 | (p_char >> 18));
+		r_text.push_back(0x80 | ((p_char >> 12) & 0x3F));
+		r_text.push_back(0x80 | ((p_char >> 6) & 0x3F));
+		r_text.push_back(0x80 | (p_char & 0x3F));
+	}
+}
+
+void JSONStreamReader::_reset() {
+	file.unref();
+	peer.unref();
+	peer_closed = false;
+	input_finished = true;
+	buffer.clear();
+	buffer_pos = 0;
+	buffer_len = 0;
+	token_scan = 0;
+	token_escape = false;
+	stack.clear();
+	state = STATE_VALUE;
+	event_type = EVENT_NONE;
+	value = Variant();
+	errored = false;
+	err_str = String();
+	current_line = 1;
+}
+
+Error JSONStreamReader::_set_error(const String &p_error) {
+	errored = true;
+	err_str = p_error;
+	event_type = EVENT_NONE;
+	value = Variant();
+	return ERR_PARSE_ERROR;
+}
+
+Error JSONStreamReader::_fill() {
+	if (input_finished) {
+		return ERR_FILE_EOF;
+	}
+
+	// Only the token being scanned is kept, the rest of the chunk is consumed.
+	if (buffer_pos > 0) {
+		memmove(buffer.ptr(), buffer.ptr() + buffer_pos, buffer_len - buffer_pos);
+		buffer_len -= buffer_pos;
+		buffer_pos = 0;
+	}
+	if (buffer.size() < buffer_len + chunk_size) {
+		buffer.resize(buffer_len + chunk_size);
+	}
+
+	uint32_t space = buffer.size() - buffer_len;
+	uint64_t received = 0;
+	if (file.is_valid()) {
+		received = file->get_buffer(buffer.ptr() + buffer_len, space);
+		if (received == 0 || file->eof_reached()) {
+			input_finished = true;
+		}
+	} else if (peer.is_valid()) {
+		int peer_received = 0;
+		if (peer->get_partial_data(buffer.ptr() + buffer_len, space, peer_received) != OK) {
+			input_finished = true; // Disconnected.
+		}
+		received = peer_received;
+		if (received == 0 && peer_closed) {
+			input_finished = true;
+		}
+	}
+	buffer_len += received;
+
+	if (received == 0) {
+		return input_finished ? ERR_FILE_EOF : ERR_BUSY;
+	}
+	return OK;
+}
+
+Error JSONStreamReader::_scan_word(bool p_number, uint32_t &r_len) {
+	while (true) {
+		const uint8_t *p = buffer.ptr() + buffer_pos;
+		uint32_t avail = buffer_len - buffer_pos;
+		uint32_t i = token_scan;
+		if (p_number) {
+			while (i < avail && _is_number_char(p[i])) {
+				i++;
+			}
+		} else {
+			while (i < avail && is_ascii_alphabet_char(p[i])) {
+				i++;
+			}
+		}
+		if (i < avail) {
+			token_scan = 0;
+			r_len = i;
+			return OK;
+		}
+
+		token_scan = i;
+		Error err = _fill();
+		if (err == ERR_FILE_EOF) {
+			token_scan = 0;
+			r_len = i; // The word ends with the input.
+			return OK;
+		} else if (err != OK) {
+			return err;
+		}
+	}
+}
+
+Error JSONStreamReader::_decode_string(const uint8_t *p_str, uint32_t p_len, Variant &r_value) {
+	bool escaped = false;
+	for (uint32_t i = 0; i < p_len; i++) {
+		if (p_str[i] == '\\') {
+			escaped = true;
+		} else if (p_str[i] == '\n') {
+			current_line++;
+		}
+	}
+
+	if (!escaped) {
+		r_value = String::utf8((const char *)p_str, p_len);
+		return OK;
+	}
+
+	token_text.clear();
+	for (uint32_t i = 0; i < p_len; i++) {
+		if (p_str[i] != '\\') {
+			token_text.push_back(p_str[i]);
+			continue;
+		}
+
+		// The closing quote was found, so an escape can't be the last character.
+		i++;
+		switch (p_str[i]) {
+			case 'b':
+				token_text.push_back(8);
+				break;
+			case 't':
+				token_text.push_back(9);
+				break;
+			case 'n':
+				token_text.push_back(10);
+				break;
+			case 'f':
+				token_text.push_back(12);
+				break;
+			case 'r':
+				token_text.push_back(13);
+				break;
+			case '"':
+			case '\\':
+			case '/':
+				token_text.push_back(p_str[i]);
+				break;
+			case 'u': {
+				char32_t res;
+				if (i + 4 >= p_len || !_parse_hex4(p_str + i + 1, res)) {
+					return _set_error("Malformed hex constant in string");
+				}
+				i += 4;
+
+				if ((res & 0xfffffc00) == 0xd800) {
+					char32_t trail;
+					if (i + 6 >= p_len || p_str[i + 1] != '\\' || p_str[i + 2] != 'u' || !_parse_hex4(p_str + i + 3, trail) || (trail & 0xfffffc00) != 0xdc00) {
+						return _set_error("Invalid UTF-16 sequence in string, unpaired lead surrogate");
+					}
+					res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+					i += 6;
+				} else if ((res & 0xfffffc00) == 0xdc00) {
+					return _set_error("Invalid UTF-16 sequence in string, unpaired trail surrogate");
+				}
+				_append_utf8(token_text, res);
+			} break;
+			default: {
+				return _set_error("Invalid escape sequence");
+			}
+		}
+	}
+
+	r_value = String::utf8(token_text.ptr(), token_text.size());
+	return OK;
+}
+
+Error JSONStreamReader::_get_token(TokenType &r_type, Variant &r_value) {
+	while (true) {
+		while (buffer_pos < buffer_len) {
+			uint8_t c = buffer[buffer_pos];
+			if (c == '\n') {
+				current_line++;
+			} else if (c > 32) {
+				break;
+			}
+			buffer_pos++;
+		}
+		if (buffer_pos < buffer_len) {
+			break;
+		}
+		Error err = _fill();
+		if (err != OK) {
+			return err;
+		}
+	}
+
+	uint8_t c = buffer[buffer_pos];
+	switch (c) {
+		case '{': {
+			r_type = TK_CURLY_BRACKET_OPEN;
+			buffer_pos++;
+			return OK;
+		}
+		case '}': {
+			r_type = TK_CURLY_BRACKET_CLOSE;
+			buffer_pos++;
+			return OK;
+		}
+		case '[': {
+			r_type = TK_BRACKET_OPEN;
+			buffer_pos++;
+			return OK;
+		}
+		case ']': {
+			r_type = TK_BRACKET_CLOSE;
+			buffer_pos++;
+			return OK;
+		}
+		case ':': {
+			r_type = TK_COLON;
+			buffer_pos++;
+			return OK;
+		}
+		case ',': {
+			r_type = TK_COMMA;
+			buffer_pos++;
+			return OK;
+		}
+		case '"': {
+			if (token_scan == 0) {
+				token_scan = 1;
+			}
+			while (true) {
+				const uint8_t *p = buffer.ptr() + buffer_pos;
+				uint32_t avail = buffer_len - buffer_pos;
+				uint32_t i = token_scan;
+				for (; i < avail; i++) {
+					if (token_escape) {
+						token_escape = false;
+					} else if (p[i] == '\\') {
+						token_escape = true;
+					} else if (p[i] == '"') {
+						break;
+					}
+				}
+
+				if (i < avail) {
+					token_scan = 0;
+					r_type = TK_STRING;
+					Error err = _decode_string(p + 1, i - 1, r_value);
+					buffer_pos += i + 1;
+					return err;
+				}
+
+				// Keep the scan position, the token may be resumed once more input is available.
+				token_scan = i;
+				Error err = _fill();
+				if (err == ERR_FILE_EOF) {
+					return _set_error("Unterminated string");
+				} else if (err != OK) {
+					return err;
+				}
+			}
+		} break;
+		default: {
+			if (c == '-' || is_digit(c)) {
+				uint32_t len;
+				Error err = _scan_word(true, len);
+				if (err != OK) {
+					return err;
+				}
+				token_text.resize(len + 1);
+				memcpy(token_text.ptr(), buffer.ptr() + buffer_pos, len);
+				token_text[len] = 0;
+				buffer_pos += len;
+				r_type = TK_NUMBER;
+				r_value = String::to_float(token_text.ptr());
+				return OK;
+			} else if (is_ascii_alphabet_char(c)) {
+				uint32_t len;
+				Error err = _scan_word(false, len);
+				if (err != OK) {
+					return err;
+				}
+				r_type = TK_IDENTIFIER;
+				r_value = String::ascii(Span((const char *)buffer.ptr() + buffer_pos, len));
+				buffer_pos += len;
+				return OK;
+			}
+			return _set_error("Unexpected character");
+		}
+	}
+}
+
+Error JSONStreamReader::_begin_value(TokenType p_type, const Variant &p_value) {
+	switch (p_type) {
+		case TK_CURLY_BRACKET_OPEN:
+		case TK_BRACKET_OPEN: {
+			if (stack.size() >= Variant::MAX_RECURSION_DEPTH) {
+				return _set_error("JSON structure is too deep");
+			}
+			bool object = p_type == TK_CURLY_BRACKET_OPEN;
+			stack.push_back(object ? CONTAINER_OBJECT : CONTAINER_ARRAY);
+			state = object ? STATE_KEY_OR_END : STATE_VALUE_OR_END;
+			event_type = object ? EVENT_OBJECT_BEGIN : EVENT_ARRAY_BEGIN;
+			value = Variant();
+			return OK;
+		}
+		case TK_IDENTIFIER: {
+			String id = p_value;
+			if (id == "true") {
+				value = true;
+			} else if (id == "false") {
+				value = false;
+			} else if (id == "null") {
+				value = Variant();
+			} else {
+				return _set_error(vformat("Expected 'true', 'false', or 'null', got '%s'", id));
+			}
+		} break;
+		case TK_NUMBER:
+		case TK_STRING: {
+			value = p_value;
+		} break;
+		default: {
+			return _set_error(vformat("Expected value, got '%s'", String(tk_name[p_type])));
+		}
+	}
+
+	event_type = EVENT_VALUE;
+	state = _state_after_value();
+	return OK;
+}
+
+Error JSONStreamReader::read() {
+	if (errored) {
+		return ERR_PARSE_ERROR;
+	}
+
+	while (true) {
+		TokenType type = TK_MAX;
+		Variant token_value;
+		Error err = _get_token(type, token_value);
+		if (err == ERR_FILE_EOF) {
+			event_type = EVENT_NONE;
+			value = Variant();
+			if (state == STATE_DONE) {
+				return ERR_FILE_EOF;
+			} else if (stack.is_empty()) {
+				return _set_error("Expected value, got 'EOF'");
+			}
+			return _set_error(stack[stack.size() - 1] == CONTAINER_OBJECT ? "Expected '}'" : "Expected ']'");
+		} else if (err != OK) {
+			return err;
+		}
+
+		switch (state) {
+			case STATE_DONE: {
+				return _set_error("Expected 'EOF'");
+			}
+			case STATE_VALUE_OR_END: {
+				if (type == TK_BRACKET_CLOSE) {
+					stack.resize(stack.size() - 1);
+					state = _state_after_value();
+					event_type = EVENT_ARRAY_END;
+					value = Variant();
+					return OK;
+				}
+				return _begin_value(type, token_value);
+			}
+			case STATE_VALUE: {
+				return _begin_value(type, token_value);
+			}
+			case STATE_KEY_OR_END:
+			case STATE_KEY: {
+				if (state == STATE_KEY_OR_END && type == TK_CURLY_BRACKET_CLOSE) {
+					stack.resize(stack.size() - 1);
+					state = _state_after_value();
+					event_type = EVENT_OBJECT_END;
+					value = Variant();
+					return OK;
+				}
+				if (type != TK_STRING) {
+					return _set_error("Expected key");
+				}
+				state = STATE_COLON;
+				event_type = EVENT_KEY;
+				value = token_value;
+				return OK;
+			}
+			case STATE_COLON: {
+				if (type != TK_COLON) {
+					return _set_error("Expected ':'");
+				}
+				state = STATE_VALUE;
+			} break;
+			case STATE_COMMA_OR_END: {
+				bool object = stack[stack.size() - 1] == CONTAINER_OBJECT;
+				if (type == TK_COMMA) {
+					state = object ? STATE_KEY : STATE_VALUE;
+					break;
+				}
+				if (type != (object ? TK_CURLY_BRACKET_CLOSE : TK_BRACKET_CLOSE)) {
+					return _set_error(object ? "Expected '}' or ','" : "Expected ','");
+				}
+				stack.resize(stack.size() - 1);
+				state = _state_after_value();
+				event_type = object ? EVENT_OBJECT_END : EVENT_ARRAY_END;
+				value = Variant();
+				return OK;
+			}
+		}
+	}
+}
+
+Error JSONStreamReader::_read_value(Variant &r_value) {
+	switch (event_type) {
+		case EVENT_KEY:
+		case EVENT_VALUE: {
+			r_value = value;
+			return OK;
+		}
+		case EVENT_OBJECT_BEGIN: {
+			Dictionary d;
+			while (true) {
+				Error err = read();
+				if (err != OK) {
+					return err;
+				}
+				if (event_type == EVENT_OBJECT_END) {
+					break;
+				}
+				String key = value;
+				err = read();
+				if (err != OK) {
+					return err;
+				}
+				Variant v;
+				err = _read_value(v);
+				if (err != OK) {
+					return err;
+				}
+				d[key] = v;
+			}
+			r_value = d;
+			return OK;
+		}
+		case EVENT_ARRAY_BEGIN: {
+			Array a;
+			while (true) {
+				Error err = read();
+				if (err != OK) {
+					return err;
+				}
+				if (event_type == EVENT_ARRAY_END) {
+					break;
+				}
+				Variant v;
+				err = _read_value(v);
+				if (err != OK) {
+					return err;
+				}
+				a.push_back(v);
+			}
+			r_value = a;
+			return OK;
+		}
+		default: {
+			r_value = Variant();
+			return OK;
+		}
+	}
+}
+
+Variant JSONStreamReader::read_value() {
+	Variant ret;
+	Error err = _read_value(ret);
+	if (err == ERR_BUSY || err == ERR_FILE_EOF) {
+		// The subtree was partially consumed, the reader can't recover from this.
+		_set_error("Incomplete input while reading a value");
+	}
+	return err == OK ? ret : Variant();
+}
+
+Error JSONStreamReader::skip_section() {
+	if (event_type != EVENT_OBJECT_BEGIN && event_type != EVENT_ARRAY_BEGIN) {
+		return OK;
+	}
+
+	uint32_t depth = stack.size() - 1;
+	while (stack.size() > depth) {
+		Error err = read();
+		if (err != OK) {
+			if (err == ERR_BUSY || err == ERR_FILE_EOF) {
+				return _set_error("Incomplete input while skipping a section");
+			}
+			return err;
+		}
+	}
+	return OK;
+}
+
+Error JSONStreamReader::open(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::READ, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot open file '%s'.", p_path));
+	return open_file(f);
+}
+
+Error JSONStreamReader::open_file(const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	_reset();
+	file = p_file;
+	input_finished = false;
+	return OK;
+}
+
+Error JSONStreamReader::open_stream_peer(const Ref<StreamPeer> &p_peer) {
+	ERR_FAIL_COND_V(p_peer.is_null(), ERR_INVALID_PARAMETER);
+	_reset();
+	peer = p_peer;
+	input_finished = false;
+	return OK;
+}
+
+Error JSONStreamReader::open_buffer(const Vector<uint8_t> &p_buffer) {
+	_reset();
+	buffer.resize(p_buffer.size());
+	if (p_buffer.size()) {
+		memcpy(buffer.ptr(), p_buffer.ptr(), p_buffer.size());
+	}
+	buffer_len = p_buffer.size();
+	return OK;
+}
+
+void JSONStreamReader::finish_input() {
+	peer_closed = true;
+}
+
+void JSONStreamReader::close() {
+	_reset();
+	state = STATE_DONE;
+}
+
+void JSONStreamReader::set_chunk_size(int p_size) {
+	ERR_FAIL_COND(p_size < 16);
+	chunk_size = p_size;
+}
+
+int JSONStreamReader::get_chunk_size() const {
+	return chunk_size;
+}
+
+JSONStreamReader::EventType JSONStreamReader::get_event_type() const {
+	return event_type;
+}
+
+Variant JSONStreamReader::get_value() const {
+	return value;
+}
+
+int JSONStreamReader::get_depth() const {
+	return stack.size();
+}
+
+int JSONStreamReader::get_current_line() const {
+	return current_line;
+}
+
+String JSONStreamReader::get_error_message() const {
+	return err_str;
+}
+
+void JSONStreamReader::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONStreamReader::open);
+	ClassDB::bind_method(D_METHOD("open_file", "file"), &JSONStreamReader::open_file);
+	ClassDB::bind_method(D_METHOD("open_stream_peer", "peer"), &JSONStreamReader::open_stream_peer);
+	ClassDB::bind_method(D_METHOD("open_buffer", "buffer"), &JSONStreamReader::open_buffer);
+	ClassDB::bind_method(D_METHOD("finish_input"), &JSONStreamReader::finish_input);
+	ClassDB::bind_method(D_METHOD("close"), &JSONStreamReader::close);
+
+	ClassDB::bind_method(D_METHOD("set_chunk_size", "size"), &JSONStreamReader::set_chunk_size);
+	ClassDB::bind_method(D_METHOD("get_chunk_size"), &JSONStreamReader::get_chunk_size);
+
+	ClassDB::bind_method(D_METHOD("read"), &JSONStreamReader::read);
+	ClassDB::bind_method(D_METHOD("get_event_type"), &JSONStreamReader::get_event_type);
+	ClassDB::bind_method(D_METHOD("get_value"), &JSONStreamReader::get_value);
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONStreamReader::get_depth);
+	ClassDB::bind_method(D_METHOD("read_value"), &JSONStreamReader::read_value);
+	ClassDB::bind_method(D_METHOD("skip_section"), &JSONStreamReader::skip_section);
+	ClassDB::bind_method(D_METHOD("get_current_line"), &JSONStreamReader::get_current_line);
+	ClassDB::bind_method(D_METHOD("get_error_message"), &JSONStreamReader::get_error_message);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "chunk_size"), "set_chunk_size", "get_chunk_size");
+
+	BIND_ENUM_CONSTANT(EVENT_NONE);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_OBJECT_END);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_BEGIN);
+	BIND_ENUM_CONSTANT(EVENT_ARRAY_END);
+	BIND_ENUM_CONSTANT(EVENT_KEY);
+	BIND_ENUM_CONSTANT(EVENT_VALUE);
+}
+
+//////////////////////////////////////////////////////////////////
+
+void JSONStreamWriter::_reset() {
+	file.unref();
+	peer.unref();
+	to_buffer = false;
+	opened = false;
+	output.clear();
+	stack.clear();
+	after_key = false;
+	root_written = false;
+}
+
+void JSONStreamWriter::_write_indent(int p_depth) {
+	if (indent_utf8.length() == 0) {
+		return;
+	}
+	_write("\n", 1);
+	for (int i = 0; i < p_depth; i++) {
+		_write(indent_utf8.get_data(), indent_utf8.length());
+	}
+}
+
+void JSONStreamWriter::_write_string(const String &p_string) {
+	CharString cs = p_string.utf8();
+	const char *str = cs.get_data();
+	int len = cs.length();
+
+	_write("\"", 1);
+	int run_start = 0;
+	for (int i = 0; i < len; i++) {
+		uint8_t c = str[i];
+		if (c >= 32 && c != '"' && c != '\\') {
+			continue;
+		}
+
+		_write(str + run_start, i - run_start);
+		run_start = i + 1;
+		switch (c) {
+			case '"':
+				_write("\\\"", 2);
+				break;
+			case '\\':
+				_write("\\\\", 2);
+				break;
+			case '\b':
+				_write("\\b", 2);
+				break;
+			case '\f':
+				_write("\\f", 2);
+				break;
+			case '\n':
+				_write("\\n", 2);
+				break;
+			case '\r':
+				_write("\\r", 2);
+				break;
+			case '\t':
+				_write("\\t", 2);
+				break;
+			default: {
+				static const char hex[] = "0123456789abcdef";
+				char esc[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+				_write(esc, 6);
+			}
+		}
+	}
+	_write(str + run_start, len - run_start);
+	_write("\"", 1);
+}
+
+Error JSONStreamWriter::_write_variant(const Variant &p_value, int p_depth, HashSet<const void *> &p_markers) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "JSON structure is too deep. Bailing.");
+
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
+			_write("null", 4);
+		} break;
+		case Variant::BOOL: {
+			if (p_value.operator bool()) {
+				_write("true", 4);
+			} else {
+				_write("false", 5);
+			}
+		} break;
+		case Variant::INT: {
+			CharString cs = itos(p_value).ascii();
+			_write(cs.get_data(), cs.length());
+		} break;
+		case Variant::FLOAT: {
+			double num = p_value;
+			// Same formatting as JSON::stringify().
+			if (num == double(0)) {
+				_write("0.0", 3);
+				break;
+			}
+			double magnitude = std::log10(Math::abs(num));
+			int total_digits = full_precision ? 17 : 14;
+			int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
+			CharString cs = String::num(num, precision).ascii();
+			_write(cs.get_data(), cs.length());
+		} break;
+		case Variant::PACKED_INT32_ARRAY:
+		case Variant::PACKED_INT64_ARRAY:
+		case Variant::PACKED_FLOAT32_ARRAY:
+		case Variant::PACKED_FLOAT64_ARRAY:
+		case Variant::PACKED_STRING_ARRAY:
+		case Variant::ARRAY: {
+			Array a = p_value;
+			if (a.is_empty()) {
+				_write("[]", 2);
+				break;
+			}
+			ERR_FAIL_COND_V_MSG(p_markers.has(a.id()), ERR_CYCLIC_LINK, "Converting circular structure to JSON.");
+			p_markers.insert(a.id());
+
+			_write("[", 1);
+			for (int i = 0; i < a.size(); i++) {
+				if (i > 0) {
+					_write(",", 1);
+				}
+				_write_indent(p_depth + 1);
+				Error err = _write_variant(a[i], p_depth + 1, p_markers);
+				if (err != OK) {
+					return err;
+				}
+			}
+			_write_indent(p_depth);
+			_write("]", 1);
+			p_markers.erase(a.id());
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary d = p_value;
+			if (d.is_empty()) {
+				_write("{}", 2);
+				break;
+			}
+			ERR_FAIL_COND_V_MSG(p_markers.has(d.id()), ERR_CYCLIC_LINK, "Converting circular structure to JSON.");
+			p_markers.insert(d.id());
+
+			_write("{", 1);
+			bool first = true;
+			for (const KeyValue<Variant, Variant> &kv : d) {
+				if (!first) {
+					_write(",", 1);
+				}
+				first = false;
+				_write_indent(p_depth + 1);
+				_write_string(kv.key);
+				_write(indent_utf8.length() ? ": " : ":", indent_utf8.length() ? 2 : 1);
+				Error err = _write_variant(kv.value, p_depth + 1, p_markers);
+				if (err != OK) {
+					return err;
+				}
+			}
+			_write_indent(p_depth);
+			_write("}", 1);
+			p_markers.erase(d.id());
+		} break;
+		default: {
+			_write_string(p_value);
+		}
+	}
+
+	return OK;
+}
+
+Error JSONStreamWriter::_begin_element() {
+	ERR_FAIL_COND_V_MSG(!opened, ERR_UNCONFIGURED, "The writer must be opened before use.");
+
+	if (stack.is_empty()) {
+		ERR_FAIL_COND_V_MSG(root_written, ERR_ALREADY_EXISTS, "Only a single root value can be written.");
+		root_written = true;
+		return OK;
+	}
+
+	Scope &scope = stack[stack.size() - 1];
+	if (scope.object) {
+		ERR_FAIL_COND_V_MSG(!after_key, ERR_INVALID_PARAMETER, "A key must be written before each value of an object.");
+		after_key = false;
+		return OK;
+	}
+
+	if (!scope.empty) {
+		_write(",", 1);
+	}
+	scope.empty = false;
+	_write_indent(stack.size());
+	return OK;
+}
+
+Error JSONStreamWriter::_flush_output(bool p_force) {
+	if (to_buffer || output.is_empty() || (!p_force && output.size() < chunk_size)) {
+		return OK;
+	}
+
+	Error err = OK;
+	if (file.is_valid()) {
+		if (!file->store_buffer(output.ptr(), output.size())) {
+			err = ERR_FILE_CANT_WRITE;
+		}
+	} else if (peer.is_valid()) {
+		err = peer->put_data(output.ptr(), output.size());
+	}
+	output.clear();
+	return err;
+}
+
+Error JSONStreamWriter::open(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(f.is_null(), err, vformat("Cannot open file '%s'.", p_path));
+	return open_file(f);
+}
+
+Error JSONStreamWriter::open_file(const Ref<FileAccess> &p_file) {
+	ERR_FAIL_COND_V(p_file.is_null(), ERR_INVALID_PARAMETER);
+	_reset();
+	file = p_file;
+	opened = true;
+	return OK;
+}
+
+Error JSONStreamWriter::open_stream_peer(const Ref<StreamPeer> &p_peer) {
+	ERR_FAIL_COND_V(p_peer.is_null(), ERR_INVALID_PARAMETER);
+	_reset();
+	peer = p_peer;
+	opened = true;
+	return OK;
+}
+
+void JSONStreamWriter::open_buffer() {
+	_reset();
+	to_buffer = true;
+	opened = true;
+}
+
+Error JSONStreamWriter::close() {
+	if (!opened) {
+		return OK;
+	}
+
+	Error err = _flush_output(true);
+	bool complete = stack.is_empty() && root_written;
+	bool keep_output = to_buffer;
+	LocalVector<uint8_t> buffered;
+	if (keep_output) {
+		buffered = output;
+	}
+	_reset();
+	if (keep_output) {
+		output = buffered;
+	}
+
+	ERR_FAIL_COND_V_MSG(!complete, ERR_INVALID_DATA, "Closing an incomplete JSON document.");
+	return err;
+}
+
+void JSONStreamWriter::set_indent(const String &p_indent) {
+	indent = p_indent;
+	indent_utf8 = p_indent.utf8();
+}
+
+String JSONStreamWriter::get_indent() const {
+	return indent;
+}
+
+void JSONStreamWriter::set_full_precision(bool p_enable) {
+	full_precision = p_enable;
+}
+
+bool JSONStreamWriter::is_full_precision() const {
+	return full_precision;
+}
+
+void JSONStreamWriter::set_chunk_size(int p_size) {
+	ERR_FAIL_COND(p_size < 16);
+	chunk_size = p_size;
+}
+
+int JSONStreamWriter::get_chunk_size() const {
+	return chunk_size;
+}
+
+Error JSONStreamWriter::begin_object() {
+	Error err = _begin_element();
+	if (err != OK) {
+		return err;
+	}
+	_write("{", 1);
+	Scope scope;
+	scope.object = true;
+	stack.push_back(scope);
+	return OK;
+}
+
+Error JSONStreamWriter::end_object() {
+	ERR_FAIL_COND_V_MSG(stack.is_empty() || !stack[stack.size() - 1].object, ERR_INVALID_PARAMETER, "No object to end.");
+	ERR_FAIL_COND_V_MSG(after_key, ERR_INVALID_PARAMETER, "The last key of the object has no value.");
+	bool empty = stack[stack.size() - 1].empty;
+	stack.resize(stack.size() - 1);
+	if (!empty) {
+		_write_indent(stack.size());
+	}
+	_write("}", 1);
+	return _flush_output(false);
+}
+
+Error JSONStreamWriter::begin_array() {
+	Error err = _begin_element();
+	if (err != OK) {
+		return err;
+	}
+	_write("[", 1);
+	stack.push_back(Scope());
+	return OK;
+}
+
+Error JSONStreamWriter::end_array() {
+	ERR_FAIL_COND_V_MSG(stack.is_empty() || stack[stack.size() - 1].object, ERR_INVALID_PARAMETER, "No array to end.");
+	bool empty = stack[stack.size() - 1].empty;
+	stack.resize(stack.size() - 1);
+	if (!empty) {
+		_write_indent(stack.size());
+	}
+	_write("]", 1);
+	return _flush_output(false);
+}
+
+Error JSONStreamWriter::write_key(const String &p_key) {
+	ERR_FAIL_COND_V_MSG(!opened, ERR_UNCONFIGURED, "The writer must be opened before use.");
+	ERR_FAIL_COND_V_MSG(stack.is_empty() || !stack[stack.size() - 1].object, ERR_INVALID_PARAMETER, "Keys can only be written inside an object.");
+	ERR_FAIL_COND_V_MSG(after_key, ERR_INVALID_PARAMETER, "The previous key has no value.");
+
+	Scope &scope = stack[stack.size() - 1];
+	if (!scope.empty) {
+		_write(",", 1);
+	}
+	scope.empty = false;
+	_write_indent(stack.size());
+	_write_string(p_key);
+	_write(indent_utf8.length() ? ": " : ":", indent_utf8.length() ? 2 : 1);
+	after_key = true;
+	return OK;
+}
+
+Error JSONStreamWriter::write_value(const Variant &p_value) {
+	Error err = _begin_element();
+	if (err != OK) {
+		return err;
+	}
+	HashSet<const void *> markers;
+	err = _write_variant(p_value, stack.size(), markers);
+	if (err != OK) {
+		return err;
+	}
+	return _flush_output(false);
+}
+
+Error JSONStreamWriter::flush() {
+	Error err = _flush_output(true);
+	if (err == OK && file.is_valid()) {
+		file->flush();
+	}
+	return err;
+}
+
+Vector<uint8_t> JSONStreamWriter::get_data() const {
+	Vector<uint8_t> ret;
+	ERR_FAIL_COND_V_MSG(!to_buffer && opened, ret, "Only a writer opened with open_buffer() keeps its data.");
+	ret.resize(output.size());
+	if (output.size()) {
+		memcpy(ret.ptrw(), output.ptr(), output.size());
+	}
+	return ret;
+}
+
+int JSONStreamWriter::get_depth() const {
+	return stack.size();
+}
+
+void JSONStreamWriter::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("open", "path"), &JSONStreamWriter::open);
+	ClassDB::bind_method(D_METHOD("open_file", "file"), &JSONStreamWriter::open_file);
+	ClassDB::bind_method(D_METHOD("open_stream_peer", "peer"), &JSONStreamWriter::open_stream_peer);
+	ClassDB::bind_method(D_METHOD("open_buffer"), &JSONStreamWriter::open_buffer);
+	ClassDB::bind_method(D_METHOD("close"), &JSONStreamWriter::close);
+
+	ClassDB::bind_method(D_METHOD("set_indent", "indent"), &JSONStreamWriter::set_indent);
+	ClassDB::bind_method(D_METHOD("get_indent"), &JSONStreamWriter::get_indent);
+	ClassDB::bind_method(D_METHOD("set_full_precision", "enable"), &JSONStreamWriter::set_full_precision);
+	ClassDB::bind_method(D_METHOD("is_full_precision"), &JSONStreamWriter::is_full_precision);
+	ClassDB::bind_method(D_METHOD("set_chunk_size", "size"), &JSONStreamWriter::set_chunk_size);
+	ClassDB::bind_method(D_METHOD("get_chunk_size"), &JSONStreamWriter::get_chunk_size);
+
+	ClassDB::bind_method(D_METHOD("begin_object"), &JSONStreamWriter::begin_object);
+	ClassDB::bind_method(D_METHOD("end_object"), &JSONStreamWriter::end_object);
+	ClassDB::bind_method(D_METHOD("begin_array"), &JSONStreamWriter::begin_array);
+	ClassDB::bind_method(D_METHOD("end_array"), &JSONStreamWriter::end_array);
+	ClassDB::bind_method(D_METHOD("write_key", "key"), &JSONStreamWriter::write_key);
+	ClassDB::bind_method(D_METHOD("write_value", "value"), &JSONStreamWriter::write_value);
+	ClassDB::bind_method(D_METHOD("flush"), &JSONStreamWriter::flush);
+	ClassDB::bind_method(D_METHOD("get_data"), &JSONStreamWriter::get_data);
+	ClassDB::bind_method(D_METHOD("get_depth"), &JSONStreamWriter::get_depth);
+
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "indent"), "set_indent", "get_indent");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "full_precision"), "set_full_precision", "is_full_precision");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "chunk_size"), "set_chunk_size", "get_chunk_size");
+}
+
+JSONStreamWriter::~JSONStreamWriter() {
+	if (opened && !to_buffer) {
+		_flush_output(true);
+	}
+}
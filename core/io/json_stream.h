@@ -0,0 +1,218 @@
+/**************************************************************************/
+/*  json_stream.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/file_access.h"
+#include "core/io/stream_peer.h"
+#include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
+
+// Pull parser reading JSON as UTF-8 bytes straight from a file, a stream peer or
+// a buffer. Only a fixed size chunk of input (grown to fit the largest single
+// token) and the container nesting are kept in memory, no document is built
+// unless read_value() is explicitly used on a subtree.
+class JSONStreamReader : public RefCounted {
+	GDCLASS(JSONStreamReader, RefCounted);
+
+public:
+	enum EventType {
+		EVENT_NONE,
+		EVENT_OBJECT_BEGIN,
+		EVENT_OBJECT_END,
+		EVENT_ARRAY_BEGIN,
+		EVENT_ARRAY_END,
+		EVENT_KEY,
+		EVENT_VALUE,
+	};
+
+private:
+	enum TokenType {
+		TK_CURLY_BRACKET_OPEN,
+		TK_CURLY_BRACKET_CLOSE,
+		TK_BRACKET_OPEN,
+		TK_BRACKET_CLOSE,
+		TK_IDENTIFIER,
+		TK_STRING,
+		TK_NUMBER,
+		TK_COLON,
+		TK_COMMA,
+		TK_MAX
+	};
+
+	enum State {
+		STATE_VALUE,
+		STATE_VALUE_OR_END,
+		STATE_KEY,
+		STATE_KEY_OR_END,
+		STATE_COLON,
+		STATE_COMMA_OR_END,
+		STATE_DONE,
+	};
+
+	enum Container : uint8_t {
+		CONTAINER_OBJECT,
+		CONTAINER_ARRAY,
+	};
+
+	static const char *tk_name[];
+
+	Ref<FileAccess> file;
+	Ref<StreamPeer> peer;
+	bool peer_closed = false;
+	bool input_finished = true;
+
+	LocalVector<uint8_t> buffer;
+	uint32_t buffer_pos = 0;
+	uint32_t buffer_len = 0;
+	uint32_t chunk_size = 65536;
+
+	// Scan progress of a token split across chunks, relative to `buffer_pos`.
+	uint32_t token_scan = 0;
+	bool token_escape = false;
+	LocalVector<char> token_text;
+
+	LocalVector<Container> stack;
+	State state = STATE_DONE;
+	EventType event_type = EVENT_NONE;
+	Variant value;
+
+	bool errored = false;
+	String err_str;
+	int current_line = 1;
+
+	void _reset();
+	Error _fill();
+	Error _scan_word(bool p_number, uint32_t &r_len);
+	Error _get_token(TokenType &r_type, Variant &r_value);
+	Error _decode_string(const uint8_t *p_str, uint32_t p_len, Variant &r_value);
+	Error _begin_value(TokenType p_type, const Variant &p_value);
+	Error _set_error(const String &p_error);
+	Error _read_value(Variant &r_value);
+
+	_FORCE_INLINE_ State _state_after_value() const { return stack.is_empty() ? STATE_DONE : STATE_COMMA_OR_END; }
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error open_file(const Ref<FileAccess> &p_file);
+	Error open_stream_peer(const Ref<StreamPeer> &p_peer);
+	Error open_buffer(const Vector<uint8_t> &p_buffer);
+	void finish_input();
+	void close();
+
+	void set_chunk_size(int p_size);
+	int get_chunk_size() const;
+
+	Error read();
+	EventType get_event_type() const;
+	Variant get_value() const;
+	int get_depth() const;
+
+	Variant read_value();
+	Error skip_section();
+
+	int get_current_line() const;
+	String get_error_message() const;
+};
+
+// Writer producing JSON as UTF-8 bytes, flushed to its target in fixed size chunks.
+class JSONStreamWriter : public RefCounted {
+	GDCLASS(JSONStreamWriter, RefCounted);
+
+	struct Scope {
+		bool object = false;
+		bool empty = true;
+	};
+
+	Ref<FileAccess> file;
+	Ref<StreamPeer> peer;
+	bool to_buffer = false;
+	bool opened = false;
+
+	LocalVector<uint8_t> output;
+	uint32_t chunk_size = 65536;
+
+	LocalVector<Scope> stack;
+	bool after_key = false;
+	bool root_written = false;
+
+	String indent;
+	CharString indent_utf8;
+	bool full_precision = false;
+
+	void _reset();
+	_FORCE_INLINE_ void _write(const char *p_str, uint32_t p_len) {
+		uint32_t ofs = output.size();
+		output.resize(ofs + p_len);
+		memcpy(output.ptr() + ofs, p_str, p_len);
+	}
+	void _write_indent(int p_depth);
+	void _write_string(const String &p_string);
+	Error _write_variant(const Variant &p_value, int p_depth, HashSet<const void *> &p_markers);
+	Error _begin_element();
+	Error _flush_output(bool p_force);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Error open(const String &p_path);
+	Error open_file(const Ref<FileAccess> &p_file);
+	Error open_stream_peer(const Ref<StreamPeer> &p_peer);
+	void open_buffer();
+	Error close();
+
+	void set_indent(const String &p_indent);
+	String get_indent() const;
+	void set_full_precision(bool p_enable);
+	bool is_full_precision() const;
+	void set_chunk_size(int p_size);
+	int get_chunk_size() const;
+
+	Error begin_object();
+	Error end_object();
+	Error begin_array();
+	Error end_array();
+	Error write_key(const String &p_key);
+	Error write_value(const Variant &p_value);
+
+	Error flush();
+	Vector<uint8_t> get_data() const;
+	int get_depth() const;
+
+	~JSONStreamWriter();
+};
+
+VARIANT_ENUM_CAST(JSONStreamReader::EventType);
@@ -58,9 +58,13 @@ ObjectID EncodedObjectAsID::get_object_id() const {
 #define ERR_FAIL_ADD_OF(a, b, err) ERR_FAIL_COND_V(((int32_t)(b)) < 0 || ((int32_t)(a)) < 0 || ((int32_t)(a)) > INT_MAX - ((int32_t)(b)), err)
 #define ERR_FAIL_MUL_OF(a, b, err) ERR_FAIL_COND_V(((int32_t)(a)) < 0 || ((int32_t)(b)) <= 0 || ((int32_t)(a)) > INT_MAX / ((int32_t)(b)), err)
 
-// Byte 0: `Variant::Type`, byte 1: unused, bytes 2 and 3: additional data.
+// Byte 0: `Variant::Type`, byte 1: encoding flags, bytes 2 and 3: additional data.
 #define HEADER_TYPE_MASK 0xFF
 
+// Marks a container whose header uses the compact flags below. Headers written by
+// older versions never set it, so compact flags without it are rejected as invalid.
+#define HEADER_DATA_FLAG_COMPACT_ENCODING (1 << 8)
+
 // For `Variant::INT`, `Variant::FLOAT` and other math types.
 #define HEADER_DATA_FLAG_64 (1 << 16)
 
@@ -90,6 +94,108 @@ enum ContainerTypeKind {
 #define GET_CONTAINER_TYPE_KIND(m_header, m_field) \
 	((ContainerTypeKind)(((m_header) & HEADER_DATA_FIELD_##m_field##_MASK) >> HEADER_DATA_FIELD_##m_field##_SHIFT))
 
+// For compact `Variant::ARRAY`, elements are stored without their own header.
+// The element header is rebuilt from the array type, plus `HEADER_DATA_FLAG_64` if the second bit is set.
+#define HEADER_DATA_FLAG_COMPACT_ARRAY (1 << 20)
+#define HEADER_DATA_FLAG_COMPACT_ARRAY_64 (1 << 21)
+
+// For compact `Variant::DICTIONARY`, same as above for keys and values separately.
+#define HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY (1 << 20)
+#define HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY_64 (1 << 21)
+#define HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE (1 << 22)
+#define HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE_64 (1 << 23)
+
+// Elements of these types can be stored without a header. Objects and containers carry
+// extra data in their header, and callables encode to nothing, which would make the
+// element count of an untrusted buffer unbounded.
+static bool _is_compact_element_type(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::NIL:
+		case Variant::OBJECT:
+		case Variant::CALLABLE:
+		case Variant::DICTIONARY:
+		case Variant::ARRAY:
+		case Variant::VARIANT_MAX:
+			return false;
+		default:
+			return true;
+	}
+}
+
+// The header shared by all elements of a compact container, so their size doesn't depend on their value.
+static uint32_t _get_compact_element_header(Variant::Type p_type) {
+	uint32_t header = p_type;
+
+	switch (p_type) {
+		case Variant::INT:
+		case Variant::FLOAT: {
+			header |= HEADER_DATA_FLAG_64;
+		} break;
+#ifdef REAL_T_IS_DOUBLE
+		case Variant::VECTOR2:
+		case Variant::VECTOR3:
+		case Variant::VECTOR4:
+		case Variant::PACKED_VECTOR2_ARRAY:
+		case Variant::PACKED_VECTOR3_ARRAY:
+		case Variant::PACKED_VECTOR4_ARRAY:
+		case Variant::TRANSFORM2D:
+		case Variant::TRANSFORM3D:
+		case Variant::PROJECTION:
+		case Variant::QUATERNION:
+		case Variant::PLANE:
+		case Variant::BASIS:
+		case Variant::RECT2:
+		case Variant::AABB: {
+			header |= HEADER_DATA_FLAG_64;
+		} break;
+#endif // REAL_T_IS_DOUBLE
+		default: {
+		} break;
+	}
+
+	return header;
+}
+
+// The encoding is little-endian, so arrays of 32 and 64-bit scalars are copied in bulk
+// and only need to be swapped on big-endian hosts.
+template <typename T>
+static void _decode_scalar_array(T *r_dst, const uint8_t *p_src, int32_t p_count) {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+#ifdef BIG_ENDIAN_ENABLED
+	for (int32_t i = 0; i < p_count; i++) {
+		if constexpr (sizeof(T) == 8) {
+			uint64_t v = decode_uint64(p_src + i * 8);
+			memcpy(&r_dst[i], &v, 8);
+		} else {
+			uint32_t v = decode_uint32(p_src + i * 4);
+			memcpy(&r_dst[i], &v, 4);
+		}
+	}
+#else
+	memcpy(r_dst, p_src, p_count * sizeof(T));
+#endif
+}
+
+template <typename T>
+static void _encode_scalar_array(const T *p_src, uint8_t *r_dst, int32_t p_count) {
+	static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+#ifdef BIG_ENDIAN_ENABLED
+	for (int32_t i = 0; i < p_count; i++) {
+		if constexpr (sizeof(T) == 8) {
+			uint64_t v;
+			memcpy(&v, &p_src[i], 8);
+			encode_uint64(v, r_dst + i * 8);
+		} else {
+			uint32_t v;
+			memcpy(&v, &p_src[i], 4);
+			encode_uint32(v, r_dst + i * 4);
+		}
+	}
+#else
+	memcpy(r_dst, p_src, p_count * sizeof(T));
+#endif
+}
+
 static Error _decode_string(const uint8_t *&buf, int &len, int *r_len, String &r_string) {
 	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
 
@@ -184,21 +290,13 @@ static Error _decode_container_type(const uint8_t *&buf, int &len, int *r_len, b
 	ERR_FAIL_V_MSG(ERR_INVALID_DATA, "Invalid container type kind."); // Future proofing.
 }
 
-Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
-	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+// Decodes what follows the header, which is either read from the buffer or rebuilt for elements of compact containers.
+static Error _decode_variant_data(Variant &r_variant, uint32_t header, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
 	const uint8_t *buf = p_buffer;
 	int len = p_len;
 
-	ERR_FAIL_COND_V(len < 4, ERR_INVALID_DATA);
-
-	uint32_t header = decode_uint32(buf);
-
-	ERR_FAIL_COND_V((header & HEADER_TYPE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
-
-	buf += 4;
-	len -= 4;
 	if (r_len) {
-		*r_len = 4;
+		*r_len = 0;
 	}
 
 	// NOTE: We cannot use `sizeof(real_t)` for decoding, in case a different size is encoded.
@@ -839,6 +937,20 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				(*r_len) += 4; // Size of count number.
 			}
 
+			ERR_FAIL_COND_V(!(header & HEADER_DATA_FLAG_COMPACT_ENCODING) && (header & (HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY | HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY_64 | HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE | HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE_64)), ERR_INVALID_DATA);
+			const bool compact_keys = header & HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY;
+			const bool compact_values = header & HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE;
+			uint32_t key_header = 0;
+			uint32_t value_header = 0;
+			if (compact_keys) {
+				ERR_FAIL_COND_V(!_is_compact_element_type(key_type.builtin_type), ERR_INVALID_DATA);
+				key_header = key_type.builtin_type | ((header & HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY_64) ? HEADER_DATA_FLAG_64 : 0);
+			}
+			if (compact_values) {
+				ERR_FAIL_COND_V(!_is_compact_element_type(value_type.builtin_type), ERR_INVALID_DATA);
+				value_header = value_type.builtin_type | ((header & HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE_64) ? HEADER_DATA_FLAG_64 : 0);
+			}
+
 			Dictionary dict;
 			if (key_type.builtin_type != Variant::NIL || value_type.builtin_type != Variant::NIL) {
 				dict.set_typed(key_type, value_type);
@@ -848,7 +960,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				Variant key, value;
 
 				int used;
-				Error err = decode_variant(key, buf, len, &used, p_allow_objects, p_depth + 1);
+				Error err = compact_keys ? _decode_variant_data(key, key_header, buf, len, &used, p_allow_objects, p_depth + 1) : decode_variant(key, buf, len, &used, p_allow_objects, p_depth + 1);
 				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
 
 				buf += used;
@@ -857,7 +969,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 					(*r_len) += used;
 				}
 
-				err = decode_variant(value, buf, len, &used, p_allow_objects, p_depth + 1);
+				err = compact_values ? _decode_variant_data(value, value_header, buf, len, &used, p_allow_objects, p_depth + 1) : decode_variant(value, buf, len, &used, p_allow_objects, p_depth + 1);
 				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
 
 				buf += used;
@@ -896,19 +1008,31 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 				(*r_len) += 4; // Size of count number.
 			}
 
+			ERR_FAIL_COND_V(!(header & HEADER_DATA_FLAG_COMPACT_ENCODING) && (header & (HEADER_DATA_FLAG_COMPACT_ARRAY | HEADER_DATA_FLAG_COMPACT_ARRAY_64)), ERR_INVALID_DATA);
+			const bool compact = header & HEADER_DATA_FLAG_COMPACT_ARRAY;
+			uint32_t elem_header = 0;
+			if (compact) {
+				ERR_FAIL_COND_V(!_is_compact_element_type(type.builtin_type), ERR_INVALID_DATA);
+				elem_header = type.builtin_type | ((header & HEADER_DATA_FLAG_COMPACT_ARRAY_64) ? HEADER_DATA_FLAG_64 : 0);
+			}
+
+			// Every element takes at least 4 bytes, which bounds the allocation below.
+			ERR_FAIL_COND_V(count > len / 4, ERR_INVALID_DATA);
+
 			Array array;
 			if (type.builtin_type != Variant::NIL) {
 				array.set_typed(type);
 			}
+			array.resize(count);
 
 			for (int i = 0; i < count; i++) {
 				int used = 0;
 				Variant elem;
-				Error err = decode_variant(elem, buf, len, &used, p_allow_objects, p_depth + 1);
+				Error err = compact ? _decode_variant_data(elem, elem_header, buf, len, &used, p_allow_objects, p_depth + 1) : decode_variant(elem, buf, len, &used, p_allow_objects, p_depth + 1);
 				ERR_FAIL_COND_V_MSG(err != OK, err, "Error when trying to decode Variant.");
 				buf += used;
 				len -= used;
-				array.push_back(elem);
+				array.set(i, elem);
 				if (r_len) {
 					(*r_len) += used;
 				}
@@ -930,10 +1054,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				uint8_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = buf[i];
-				}
+				memcpy(data.ptrw(), buf, count);
 			}
 
 			r_variant = data;
@@ -957,12 +1078,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int32_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int32_t *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_uint32(&buf[i * 4]);
-				}
+				_decode_scalar_array(data.ptrw(), buf, count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -981,12 +1098,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<int64_t> data;
 
 			if (count) {
-				//const int *rbuf = (const int *)buf;
 				data.resize(count);
-				int64_t *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_uint64(&buf[i * 8]);
-				}
+				_decode_scalar_array(data.ptrw(), buf, count);
 			}
 			r_variant = Variant(data);
 			if (r_len) {
@@ -1005,12 +1118,8 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 			Vector<float> data;
 
 			if (count) {
-				//const float *rbuf = (const float *)buf;
 				data.resize(count);
-				float *w = data.ptrw();
-				for (int32_t i = 0; i < count; i++) {
-					w[i] = decode_float(&buf[i * 4]);
-				}
+				_decode_scalar_array(data.ptrw(), buf, count);
 			}
 			r_variant = data;
 
@@ -1031,10 +1140,7 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				data.resize(count);
-				double *w = data.ptrw();
-				for (int64_t i = 0; i < count; i++) {
-					w[i] = decode_double(&buf[i * 8]);
-				}
+				_decode_scalar_array(data.ptrw(), buf, count);
 			}
 			r_variant = data;
 
@@ -1209,15 +1315,9 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 
 			if (count) {
 				carray.resize(count);
-				Color *w = carray.ptrw();
-
-				for (int32_t i = 0; i < count; i++) {
-					// Colors should always be in single-precision.
-					w[i].r = decode_float(buf + i * 4 * 4 + 4 * 0);
-					w[i].g = decode_float(buf + i * 4 * 4 + 4 * 1);
-					w[i].b = decode_float(buf + i * 4 * 4 + 4 * 2);
-					w[i].a = decode_float(buf + i * 4 * 4 + 4 * 3);
-				}
+				// Colors should always be in single-precision.
+				static_assert(sizeof(Color) == 4 * 4);
+				_decode_scalar_array((float *)carray.ptrw(), buf, count * 4);
 
 				int adv = 4 * 4 * count;
 
@@ -1304,6 +1404,21 @@ Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int
 	return OK;
 }
 
+Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len, bool p_allow_objects, int p_depth) {
+	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Variant is too deep. Bailing.");
+	ERR_FAIL_COND_V(p_len < 4, ERR_INVALID_DATA);
+
+	uint32_t header = decode_uint32(p_buffer);
+
+	ERR_FAIL_COND_V((header & HEADER_TYPE_MASK) >= Variant::VARIANT_MAX, ERR_INVALID_DATA);
+
+	Error err = _decode_variant_data(r_variant, header, p_buffer + 4, p_len - 4, r_len, p_allow_objects, p_depth);
+	if (r_len) {
+		(*r_len) += 4;
+	}
+	return err;
+}
+
 static void _encode_string(const String &p_string, uint8_t *&buf, int &r_len) {
 	CharString utf8 = p_string.utf8();
 
@@ -1360,7 +1475,9 @@ static Error _encode_container_type(const ContainerType &p_type, uint8_t *&buf,
 	return OK;
 }
 
-Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth) {
+static Error _encode_variant_data(const Variant &p_variant, uint32_t header, uint8_t *buf, int &r_len, bool p_full_objects, int p_depth, bool p_compact);
+
+Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects, int p_depth, bool p_compact) {
 	ERR_FAIL_COND_V_MSG(p_depth > Variant::MAX_RECURSION_DEPTH, ERR_OUT_OF_MEMORY, "Potential infinite recursion detected. Bailing.");
 	uint8_t *buf = r_buffer;
 
@@ -1402,10 +1519,35 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			const Dictionary dict = p_variant;
 			_encode_container_type_header(dict.get_key_type(), header, HEADER_DATA_FIELD_TYPED_DICTIONARY_KEY_SHIFT, p_full_objects);
 			_encode_container_type_header(dict.get_value_type(), header, HEADER_DATA_FIELD_TYPED_DICTIONARY_VALUE_SHIFT, p_full_objects);
+			if (p_compact) {
+				const Variant::Type key_type = Variant::Type(dict.get_typed_key_builtin());
+				if (_is_compact_element_type(key_type)) {
+					header |= HEADER_DATA_FLAG_COMPACT_ENCODING | HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY;
+					if (_get_compact_element_header(key_type) & HEADER_DATA_FLAG_64) {
+						header |= HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY_64;
+					}
+				}
+				const Variant::Type value_type = Variant::Type(dict.get_typed_value_builtin());
+				if (_is_compact_element_type(value_type)) {
+					header |= HEADER_DATA_FLAG_COMPACT_ENCODING | HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE;
+					if (_get_compact_element_header(value_type) & HEADER_DATA_FLAG_64) {
+						header |= HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE_64;
+					}
+				}
+			}
 		} break;
 		case Variant::ARRAY: {
 			const Array array = p_variant;
 			_encode_container_type_header(array.get_element_type(), header, HEADER_DATA_FIELD_TYPED_ARRAY_SHIFT, p_full_objects);
+			if (p_compact) {
+				const Variant::Type type = Variant::Type(array.get_typed_builtin());
+				if (_is_compact_element_type(type)) {
+					header |= HEADER_DATA_FLAG_COMPACT_ENCODING | HEADER_DATA_FLAG_COMPACT_ARRAY;
+					if (_get_compact_element_header(type) & HEADER_DATA_FLAG_64) {
+						header |= HEADER_DATA_FLAG_COMPACT_ARRAY_64;
+					}
+				}
+			}
 		} break;
 #ifdef REAL_T_IS_DOUBLE
 		case Variant::VECTOR2:
@@ -1436,6 +1578,11 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 	}
 	r_len += 4;
 
+	return _encode_variant_data(p_variant, header, buf, r_len, p_full_objects, p_depth, p_compact);
+}
+
+// Encodes what follows the header, adding to `r_len`. Also used for elements of compact containers, which have no header of their own.
+static Error _encode_variant_data(const Variant &p_variant, uint32_t header, uint8_t *buf, int &r_len, bool p_full_objects, int p_depth, bool p_compact) {
 	switch (p_variant.get_type()) {
 		case Variant::NIL: {
 			// Nothing to do.
@@ -1792,7 +1939,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 						}
 
 						int len;
-						Error err = encode_variant(value, buf, len, p_full_objects, p_depth + 1);
+						Error err = encode_variant(value, buf, len, p_full_objects, p_depth + 1, p_compact);
 						ERR_FAIL_COND_V(err, err);
 						ERR_FAIL_COND_V(len % 4, ERR_BUG);
 						r_len += len;
@@ -1851,9 +1998,12 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			}
 			r_len += 4;
 
+			const uint32_t key_header = _get_compact_element_header(Variant::Type(dict.get_typed_key_builtin()));
+			const uint32_t value_header = _get_compact_element_header(Variant::Type(dict.get_typed_value_builtin()));
+
 			for (const KeyValue<Variant, Variant> &kv : dict) {
-				int len;
-				Error err = encode_variant(kv.key, buf, len, p_full_objects, p_depth + 1);
+				int len = 0;
+				Error err = (header & HEADER_DATA_FLAG_COMPACT_DICTIONARY_KEY) ? _encode_variant_data(kv.key, key_header, buf, len, p_full_objects, p_depth + 1, p_compact) : encode_variant(kv.key, buf, len, p_full_objects, p_depth + 1, p_compact);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
 				r_len += len;
@@ -1862,7 +2012,8 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 				}
 				const Variant *value = dict.getptr(kv.key);
 				ERR_FAIL_NULL_V(value, ERR_BUG);
-				err = encode_variant(*value, buf, len, p_full_objects, p_depth + 1);
+				len = 0;
+				err = (header & HEADER_DATA_FLAG_COMPACT_DICTIONARY_VALUE) ? _encode_variant_data(*value, value_header, buf, len, p_full_objects, p_depth + 1, p_compact) : encode_variant(*value, buf, len, p_full_objects, p_depth + 1, p_compact);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
 				r_len += len;
@@ -1888,9 +2039,11 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			}
 			r_len += 4;
 
+			const uint32_t elem_header = _get_compact_element_header(Variant::Type(array.get_typed_builtin()));
+
 			for (const Variant &elem : array) {
-				int len;
-				Error err = encode_variant(elem, buf, len, p_full_objects, p_depth + 1);
+				int len = 0;
+				Error err = (header & HEADER_DATA_FLAG_COMPACT_ARRAY) ? _encode_variant_data(elem, elem_header, buf, len, p_full_objects, p_depth + 1, p_compact) : encode_variant(elem, buf, len, p_full_objects, p_depth + 1, p_compact);
 				ERR_FAIL_COND_V(err, err);
 				ERR_FAIL_COND_V(len % 4, ERR_BUG);
 				if (buf) {
@@ -1934,10 +2087,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int32_t *r = data.ptr();
-				for (int32_t i = 0; i < datalen; i++) {
-					encode_uint32(r[i], &buf[i * datasize]);
-				}
+				_encode_scalar_array(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1951,10 +2101,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const int64_t *r = data.ptr();
-				for (int64_t i = 0; i < datalen; i++) {
-					encode_uint64(r[i], &buf[i * datasize]);
-				}
+				_encode_scalar_array(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1968,10 +2115,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const float *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_float(r[i], &buf[i * datasize]);
-				}
+				_encode_scalar_array(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -1985,10 +2129,7 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			if (buf) {
 				encode_uint32(datalen, buf);
 				buf += 4;
-				const double *r = data.ptr();
-				for (int i = 0; i < datalen; i++) {
-					encode_double(r[i], &buf[i * datasize]);
-				}
+				_encode_scalar_array(data.ptr(), buf, datalen);
 			}
 
 			r_len += 4 + datalen * datasize;
@@ -2086,15 +2227,10 @@ Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bo
 			r_len += 4;
 
 			if (buf) {
-				for (int i = 0; i < len; i++) {
-					Color c = data.get(i);
-
-					encode_float(c.r, &buf[0]);
-					encode_float(c.g, &buf[4]);
-					encode_float(c.b, &buf[8]);
-					encode_float(c.a, &buf[12]);
-					buf += 4 * 4; // Colors should always be in single-precision.
-				}
+				// Colors should always be in single-precision.
+				static_assert(sizeof(Color) == 4 * 4);
+				_encode_scalar_array((const float *)data.ptr(), buf, len * 4);
+				buf += 4 * 4 * len;
 			}
 
 			r_len += 4 * 4 * len;
@@ -224,6 +224,8 @@ public:
 };
 
 Error decode_variant(Variant &r_variant, const uint8_t *p_buffer, int p_len, int *r_len = nullptr, bool p_allow_objects = false, int p_depth = 0);
-Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0);
+// With `p_compact`, typed arrays and dictionaries store their elements without per-element headers,
+// and mark their header so decoding can tell both forms apart. Older engine versions can't read compact data.
+Error encode_variant(const Variant &p_variant, uint8_t *r_buffer, int &r_len, bool p_full_objects = false, int p_depth = 0, bool p_compact = false);
 
 Vector<float> vector3_to_float32_array(const Vector3 *vecs, size_t count);
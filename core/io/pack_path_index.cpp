@@ -0,0 +1,292 @@
+/**************************************************************************/
+/*  pack_path_index.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "pack_path_index.h"
+
+#include "core/crypto/crypto_core.h"
+#include "core/io/file_access_pack.h" // PACK_FILE_REMOVAL
+#include "core/io/marshalls.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+
+// Upper bound on displacement attempts per bucket, with the load factor below a bucket
+// almost always settles within a few dozen tries.
+static constexpr uint32_t PACK_PATH_INDEX_MAX_SEED = 1 << 16;
+static constexpr uint32_t PACK_PATH_INDEX_EMPTY_SLOT = 0xFFFFFFFF;
+
+uint32_t PackPathIndex::_hash(const uint8_t *p_path_md5, uint32_t p_seed) {
+	// Keys are MD5 digests, read as little endian so the index is portable across hosts.
+	uint32_t h = hash_murmur3_one_64(decode_uint64(p_path_md5), p_seed);
+	h = hash_murmur3_one_64(decode_uint64(p_path_md5 + 8), h);
+	return hash_fmix32(h);
+}
+
+Vector<uint8_t> PackPathIndex::build(const Vector<Source> &p_sources) {
+	struct Key {
+		uint8_t path_md5[16];
+		CharString path;
+		uint32_t source = 0;
+	};
+
+	LocalVector<Key> keys;
+	keys.reserve(p_sources.size());
+	HashMap<String, uint32_t> key_map;
+	uint32_t total_strings = 0;
+	for (int i = 0; i < p_sources.size(); i++) {
+		const Source &src = p_sources[i];
+		if (src.flags & PACK_FILE_REMOVAL) { // Removals only make sense when layered over another pack.
+			continue;
+		}
+		String path = src.path.simplify_path().trim_prefix("res://");
+		HashMap<String, uint32_t>::Iterator E = key_map.find(path);
+		if (E) {
+			keys[E->value].source = i; // Same path added again, the last one wins.
+			continue;
+		}
+		Key key;
+		key.path = path.utf8();
+		CryptoCore::md5((const unsigned char *)key.path.get_data(), key.path.length(), key.path_md5);
+		key.source = i;
+		total_strings += key.path.length();
+		key_map.insert(path, keys.size());
+		keys.push_back(key);
+	}
+
+	if (keys.is_empty()) {
+		return Vector<uint8_t>();
+	}
+
+	const uint32_t count = keys.size();
+	const uint32_t buckets = (count + 3) / 4;
+	// ~80% load factor keeps the displacement search short.
+	const uint32_t slots_total = count + count / 4 + 1;
+
+	LocalVector<LocalVector<uint32_t>> bucket_keys;
+	bucket_keys.resize(buckets);
+	for (uint32_t i = 0; i < count; i++) {
+		bucket_keys[_hash(keys[i].path_md5, 0) % buckets].push_back(i);
+	}
+
+	struct BucketOrder {
+		uint32_t size = 0;
+		uint32_t bucket = 0;
+		bool operator<(const BucketOrder &p_other) const {
+			// Largest buckets first, they are the hardest to place.
+			return size > p_other.size || (size == p_other.size && bucket < p_other.bucket);
+		}
+	};
+
+	LocalVector<BucketOrder> order;
+	order.resize(buckets);
+	for (uint32_t i = 0; i < buckets; i++) {
+		order[i].size = bucket_keys[i].size();
+		order[i].bucket = i;
+	}
+	order.sort();
+
+	LocalVector<uint32_t> seed_table;
+	seed_table.resize(buckets);
+	for (uint32_t i = 0; i < buckets; i++) {
+		seed_table[i] = 0;
+	}
+	LocalVector<uint32_t> slot_table;
+	slot_table.resize(slots_total);
+	for (uint32_t i = 0; i < slots_total; i++) {
+		slot_table[i] = PACK_PATH_INDEX_EMPTY_SLOT;
+	}
+
+	LocalVector<uint32_t> taken;
+	for (const BucketOrder &bo : order) {
+		const LocalVector<uint32_t> &bucket = bucket_keys[bo.bucket];
+		if (bucket.is_empty()) {
+			break;
+		}
+
+		bool placed = false;
+		for (uint32_t seed = 1; seed < PACK_PATH_INDEX_MAX_SEED && !placed; seed++) {
+			taken.clear();
+			placed = true;
+			for (uint32_t key : bucket) {
+				uint32_t slot = _hash(keys[key].path_md5, seed) % slots_total;
+				if (slot_table[slot] != PACK_PATH_INDEX_EMPTY_SLOT || taken.has(slot)) {
+					placed = false;
+					break;
+				}
+				taken.push_back(slot);
+			}
+			if (placed) {
+				seed_table[bo.bucket] = seed;
+				for (uint32_t j = 0; j < bucket.size(); j++) {
+					slot_table[taken[j]] = bucket[j];
+				}
+			}
+		}
+		// Only fails if two paths share the same MD5.
+		ERR_FAIL_COND_V_MSG(!placed, Vector<uint8_t>(), "Can't build the PCK path index, colliding path hashes.");
+	}
+
+	Vector<uint8_t> ret;
+	ret.resize(HEADER_SIZE + buckets * 4 + slots_total * 4 + count * ENTRY_SIZE + total_strings);
+	uint8_t *w = ret.ptrw();
+	memset(w, 0, ret.size());
+
+	encode_uint32(MAGIC, w + 0);
+	encode_uint32(FORMAT_VERSION, w + 4);
+	encode_uint32(count, w + 8);
+	encode_uint32(buckets, w + 12);
+	encode_uint32(slots_total, w + 16);
+	encode_uint32(total_strings, w + 20);
+
+	uint8_t *seeds_w = w + HEADER_SIZE;
+	for (uint32_t i = 0; i < buckets; i++) {
+		encode_uint32(seed_table[i], seeds_w + i * 4);
+	}
+	uint8_t *slots_w = seeds_w + buckets * 4;
+	for (uint32_t i = 0; i < slots_total; i++) {
+		encode_uint32(slot_table[i], slots_w + i * 4);
+	}
+	uint8_t *entries_w = slots_w + slots_total * 4;
+	uint8_t *strings_w = entries_w + count * ENTRY_SIZE;
+
+	uint32_t string_ofs = 0;
+	for (uint32_t i = 0; i < count; i++) {
+		const Key &key = keys[i];
+		const Source &src = p_sources[key.source];
+		uint8_t *e = entries_w + i * ENTRY_SIZE;
+
+		memcpy(e + ENTRY_PATH_MD5, key.path_md5, 16);
+		encode_uint64(src.ofs, e + ENTRY_OFS);
+		encode_uint64(src.size, e + ENTRY_SIZE_FIELD);
+		if (src.md5) {
+			memcpy(e + ENTRY_MD5, src.md5, 16);
+		}
+		encode_uint32(src.flags, e + ENTRY_FLAGS);
+		encode_uint32(string_ofs, e + ENTRY_PATH_OFS);
+		encode_uint32(key.path.length(), e + ENTRY_PATH_LEN);
+
+		memcpy(strings_w + string_ofs, key.path.get_data(), key.path.length());
+		string_ofs += key.path.length();
+	}
+
+	return ret;
+}
+
+Error PackPathIndex::load(const Vector<uint8_t> &p_data) {
+	clear();
+
+	ERR_FAIL_COND_V(p_data.size() < HEADER_SIZE, ERR_FILE_CORRUPT);
+	const uint8_t *r = p_data.ptr();
+	ERR_FAIL_COND_V(decode_uint32(r + 0) != MAGIC, ERR_FILE_UNRECOGNIZED);
+	ERR_FAIL_COND_V(decode_uint32(r + 4) != FORMAT_VERSION, ERR_FILE_UNRECOGNIZED);
+
+	uint32_t count = decode_uint32(r + 8);
+	uint32_t buckets = decode_uint32(r + 12);
+	uint32_t slots_total = decode_uint32(r + 16);
+	uint32_t total_strings = decode_uint32(r + 20);
+	ERR_FAIL_COND_V(count == 0 || buckets == 0 || slots_total < count, ERR_FILE_CORRUPT);
+
+	uint64_t expected = uint64_t(HEADER_SIZE) + uint64_t(buckets) * 4 + uint64_t(slots_total) * 4 + uint64_t(count) * ENTRY_SIZE + total_strings;
+	ERR_FAIL_COND_V(expected != uint64_t(p_data.size()), ERR_FILE_CORRUPT);
+
+	data = p_data;
+	entry_count = count;
+	bucket_count = buckets;
+	slot_count = slots_total;
+	strings_size = total_strings;
+
+	// The blob is queried in place, no per entry structure is built.
+	seeds = data.ptr() + HEADER_SIZE;
+	slots = seeds + bucket_count * 4;
+	entries = slots + slot_count * 4;
+	strings = entries + entry_count * ENTRY_SIZE;
+
+	return OK;
+}
+
+void PackPathIndex::clear() {
+	data.clear();
+	entry_count = 0;
+	bucket_count = 0;
+	slot_count = 0;
+	strings_size = 0;
+	seeds = nullptr;
+	slots = nullptr;
+	entries = nullptr;
+	strings = nullptr;
+}
+
+int64_t PackPathIndex::find(const uint8_t *p_path_md5) const {
+	if (!entries) {
+		return -1;
+	}
+
+	uint32_t seed = decode_uint32(seeds + (_hash(p_path_md5, 0) % bucket_count) * 4);
+	if (seed == 0) {
+		return -1; // Empty bucket.
+	}
+
+	uint32_t index = decode_uint32(slots + (_hash(p_path_md5, seed) % slot_count) * 4);
+	if (index >= entry_count) {
+		return -1;
+	}
+
+	// Keys that aren't in the index still land on some slot, so the stored key must be checked.
+	if (memcmp(entries + index * ENTRY_SIZE + ENTRY_PATH_MD5, p_path_md5, 16) != 0) {
+		return -1;
+	}
+
+	return index;
+}
+
+PackPathIndex::Entry PackPathIndex::get_entry(uint32_t p_index) const {
+	Entry ret;
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, entry_count, ret);
+
+	const uint8_t *e = entries + p_index * ENTRY_SIZE;
+	ret.path_md5 = e + ENTRY_PATH_MD5;
+	ret.ofs = decode_uint64(e + ENTRY_OFS);
+	ret.size = decode_uint64(e + ENTRY_SIZE_FIELD);
+	ret.md5 = e + ENTRY_MD5;
+	ret.flags = decode_uint32(e + ENTRY_FLAGS);
+	return ret;
+}
+
+String PackPathIndex::get_entry_path(uint32_t p_index) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, entry_count, String());
+
+	const uint8_t *e = entries + p_index * ENTRY_SIZE;
+	uint32_t ofs = decode_uint32(e + ENTRY_PATH_OFS);
+	uint32_t len = decode_uint32(e + ENTRY_PATH_LEN);
+	ERR_FAIL_COND_V(uint64_t(ofs) + len > strings_size, String());
+
+	return String::utf8((const char *)strings + ofs, len);
+}
@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*  pack_path_index.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/string/ustring.h"
+#include "core/templates/vector.h"
+
+// Prebuilt perfect hash index over the paths of a PCK directory.
+//
+// The PCK writers serialize it next to the regular directory, and PackedData
+// resolves paths straight from the loaded blob: a pack mounted through its
+// index doesn't hash every path nor allocate an entry per file, and lookups
+// cost one bucket seed, one slot and one key comparison (hash and displace).
+class PackPathIndex {
+public:
+	static constexpr uint32_t MAGIC = 0x49504447; // "GDPI" in ASCII.
+	static constexpr uint32_t FORMAT_VERSION = 1;
+
+	struct Source {
+		String path;
+		uint64_t ofs = 0;
+		uint64_t size = 0;
+		const uint8_t *md5 = nullptr;
+		uint32_t flags = 0;
+	};
+
+	struct Entry {
+		const uint8_t *path_md5 = nullptr;
+		uint64_t ofs = 0;
+		uint64_t size = 0;
+		const uint8_t *md5 = nullptr;
+		uint32_t flags = 0;
+	};
+
+private:
+	enum {
+		HEADER_SIZE = 24,
+		ENTRY_SIZE = 64,
+		ENTRY_PATH_MD5 = 0,
+		ENTRY_OFS = 16,
+		ENTRY_SIZE_FIELD = 24,
+		ENTRY_MD5 = 32,
+		ENTRY_FLAGS = 48,
+		ENTRY_PATH_OFS = 52,
+		ENTRY_PATH_LEN = 56,
+	};
+
+	Vector<uint8_t> data;
+	uint32_t entry_count = 0;
+	uint32_t bucket_count = 0;
+	uint32_t slot_count = 0;
+	uint32_t strings_size = 0;
+	const uint8_t *seeds = nullptr;
+	const uint8_t *slots = nullptr;
+	const uint8_t *entries = nullptr;
+	const uint8_t *strings = nullptr;
+
+	static uint32_t _hash(const uint8_t *p_path_md5, uint32_t p_seed);
+
+public:
+	// Returns an empty buffer if there is nothing to index or the hash couldn't be built,
+	// in which case the pack is simply mounted from its directory.
+	static Vector<uint8_t> build(const Vector<Source> &p_sources);
+
+	Error load(const Vector<uint8_t> &p_data);
+	void clear();
+
+	_FORCE_INLINE_ bool is_valid() const { return entries != nullptr; }
+	_FORCE_INLINE_ uint32_t get_entry_count() const { return entry_count; }
+
+	int64_t find(const uint8_t *p_path_md5) const;
+	Entry get_entry(uint32_t p_index) const;
+	String get_entry_path(uint32_t p_index) const;
+};
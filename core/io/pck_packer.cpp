@@ -36,6 +36,7 @@
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/pack_path_index.h"
 #include "core/version.h"
 
 static int _get_pad(int p_alignment, int p_n) {
@@ -97,7 +98,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->store_32(REDOT_VERSION_MINOR);
 	file->store_32(REDOT_VERSION_PATCH);
 
-	uint32_t pack_flags = 0;
+	pack_flags = 0;
 	if (enc_dir) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
 	}
@@ -228,6 +229,26 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.unref();
 	}
 
+	// Prebuilt path index, lets the pack be mounted without parsing the directory.
+	// Not written for encrypted directories, since it would expose the file paths.
+	Vector<uint8_t> path_index;
+	if (!enc_dir) {
+		Vector<PackPathIndex::Source> index_sources;
+		index_sources.resize(files.size());
+		for (int i = 0; i < files.size(); i++) {
+			PackPathIndex::Source &src = index_sources.write[i];
+			src.path = files[i].path;
+			src.ofs = files[i].ofs;
+			src.size = files[i].size;
+			src.md5 = files[i].md5.ptr();
+			src.flags = (files[i].encrypted ? PACK_FILE_ENCRYPTED : 0) | (files[i].removal ? PACK_FILE_REMOVAL : 0);
+		}
+		path_index = PackPathIndex::build(index_sources);
+	}
+
+	uint64_t path_index_ofs = file->get_position();
+	file->store_buffer(path_index);
+
 	int header_padding = _get_pad(alignment, file->get_position());
 	for (int i = 0; i < header_padding; i++) {
 		file->store_8(0);
@@ -236,6 +257,12 @@ Error PCKPacker::flush(bool p_verbose) {
 	uint64_t file_base = file->get_position();
 	file->seek(file_base_ofs);
 	file->store_64(file_base); // update files base
+	if (!path_index.is_empty()) {
+		file->store_64(path_index_ofs);
+		file->store_64(path_index.size());
+		file->seek(file_base_ofs - 4);
+		file->store_32(pack_flags | PACK_PATH_INDEX); // update flags
+	}
 	file->seek(file_base);
 
 	const uint32_t buf_max = 65536;
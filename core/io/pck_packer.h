@@ -45,6 +45,7 @@ class PCKPacker : public RefCounted {
 
 	Vector<uint8_t> key;
 	bool enc_dir = false;
+	uint32_t pack_flags = 0;
 
 	static void _bind_methods();
 
@@ -0,0 +1,293 @@
+/**************************************************************************/
+/*  resource_streamer.cpp                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "resource_streamer.h"
+
+ResourceStreamer *ResourceStreamer::singleton = nullptr;
+
+void ResourceStreamer::_queue_push(int64_t p_id, int p_priority) {
+	QueueEntry entry;
+	entry.id = p_id;
+	entry.priority = p_priority;
+	queue.push_back(entry);
+
+	SortArray<QueueEntry, QueueEntryComparator> sorter;
+	sorter.push_heap(0, queue.size() - 1, 0, entry, queue.ptr());
+}
+
+void ResourceStreamer::_queue_compact() {
+	// Only rebuild once stale entries outnumber the queued requests, so this stays amortized O(log N) per change.
+	if (queue.size() <= uint32_t(queued_count) * 2 + 16) {
+		return;
+	}
+
+	queue.clear();
+	for (const KeyValue<int64_t, Request> &E : requests) {
+		if (E.value.status == STATUS_QUEUED) {
+			QueueEntry entry;
+			entry.id = E.key;
+			entry.priority = E.value.priority;
+			queue.push_back(entry);
+		}
+	}
+
+	SortArray<QueueEntry, QueueEntryComparator> sorter;
+	sorter.make_heap(0, queue.size(), queue.ptr());
+}
+
+void ResourceStreamer::_dispatch() {
+	SortArray<QueueEntry, QueueEntryComparator> sorter;
+
+	while (loading_count < max_concurrent_loads && queued_count > 0) {
+		ERR_FAIL_COND(queue.is_empty());
+
+		const QueueEntry top = queue[0];
+		sorter.pop_heap(0, queue.size(), queue.ptr());
+		queue.resize(queue.size() - 1);
+
+		Request *req = requests.getptr(top.id);
+		if (!req || req->status != STATUS_QUEUED || req->priority != top.priority) {
+			continue; // Canceled, already started, or superseded by a newer priority.
+		}
+
+		queued_count--;
+		Error err = ResourceLoader::load_threaded_request(req->path, req->type_hint, false, req->cache_mode);
+		if (err != OK) {
+			req->status = STATUS_FAILED;
+			finished.push_back(top.id);
+		} else {
+			req->status = STATUS_LOADING;
+			loading_count++;
+		}
+	}
+
+	if (queued_count == 0) {
+		queue.clear();
+	}
+}
+
+int64_t ResourceStreamer::request(const String &p_path, const String &p_type_hint, int p_priority, ResourceFormatLoader::CacheMode p_cache_mode) {
+	ERR_FAIL_COND_V_MSG(p_path.is_empty(), 0, "Can't stream a resource from an empty path.");
+
+	MutexLock lock(mutex);
+	int64_t id = ++last_id;
+	Request &req = requests[id];
+	req.path = p_path;
+	req.type_hint = p_type_hint;
+	req.cache_mode = p_cache_mode;
+	req.priority = p_priority;
+	queued_count++;
+	_queue_push(id, p_priority);
+
+	_dispatch();
+	return id;
+}
+
+void ResourceStreamer::set_priority(int64_t p_id, int p_priority) {
+	MutexLock lock(mutex);
+	Request *req = requests.getptr(p_id);
+	ERR_FAIL_NULL_MSG(req, vformat("Invalid resource streaming request ID: %d.", p_id));
+	if (req->priority == p_priority) {
+		return;
+	}
+
+	req->priority = p_priority;
+	if (req->status == STATUS_QUEUED) {
+		_queue_push(p_id, p_priority);
+		_queue_compact();
+	}
+}
+
+int ResourceStreamer::get_priority(int64_t p_id) const {
+	MutexLock lock(mutex);
+	const Request *req = requests.getptr(p_id);
+	ERR_FAIL_NULL_V_MSG(req, 0, vformat("Invalid resource streaming request ID: %d.", p_id));
+	return req->priority;
+}
+
+void ResourceStreamer::cancel(int64_t p_id) {
+	MutexLock lock(mutex);
+	Request *req = requests.getptr(p_id);
+	ERR_FAIL_NULL_MSG(req, vformat("Invalid resource streaming request ID: %d.", p_id));
+
+	switch (req->status) {
+		case STATUS_QUEUED: {
+			queued_count--;
+		} break;
+		case STATUS_LOADING: {
+			// ResourceLoader can't abort a load, so keep its slot taken until it's done.
+			canceled_loads.push_back(req->path);
+		} break;
+		default: {
+		} break;
+	}
+
+	requests.erase(p_id);
+	_queue_compact();
+}
+
+ResourceStreamer::Status ResourceStreamer::get_status(int64_t p_id) const {
+	MutexLock lock(mutex);
+	const Request *req = requests.getptr(p_id);
+	if (!req) {
+		return STATUS_INVALID;
+	}
+	return req->status;
+}
+
+float ResourceStreamer::get_progress(int64_t p_id) const {
+	MutexLock lock(mutex);
+	const Request *req = requests.getptr(p_id);
+	ERR_FAIL_NULL_V_MSG(req, 0.0, vformat("Invalid resource streaming request ID: %d.", p_id));
+	return req->progress;
+}
+
+Ref<Resource> ResourceStreamer::get_resource(int64_t p_id) {
+	MutexLock lock(mutex);
+	Request *req = requests.getptr(p_id);
+	ERR_FAIL_NULL_V_MSG(req, Ref<Resource>(), vformat("Invalid resource streaming request ID: %d.", p_id));
+	ERR_FAIL_COND_V_MSG(req->status == STATUS_QUEUED || req->status == STATUS_LOADING, Ref<Resource>(), vformat("Resource streaming request %d for '%s' has not finished yet.", p_id, req->path));
+
+	Ref<Resource> res = req->resource;
+	requests.erase(p_id);
+	return res;
+}
+
+void ResourceStreamer::set_max_concurrent_loads(int p_count) {
+	ERR_FAIL_COND_MSG(p_count < 1, "At least one load must be allowed at a time.");
+	MutexLock lock(mutex);
+	max_concurrent_loads = p_count;
+	_dispatch();
+}
+
+int ResourceStreamer::get_max_concurrent_loads() const {
+	MutexLock lock(mutex);
+	return max_concurrent_loads;
+}
+
+int ResourceStreamer::get_queued_count() const {
+	MutexLock lock(mutex);
+	return queued_count;
+}
+
+int ResourceStreamer::get_loading_count() const {
+	MutexLock lock(mutex);
+	return loading_count;
+}
+
+void ResourceStreamer::poll() {
+	LocalVector<int64_t> to_emit;
+
+	{
+		MutexLock lock(mutex);
+
+		if (loading_count) {
+			for (List<String>::Element *E = canceled_loads.front(); E;) {
+				List<String>::Element *N = E->next();
+				if (ResourceLoader::load_threaded_get_status(E->get()) != ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+					// Releases the load token, the result is discarded.
+					ResourceLoader::load_threaded_get(E->get());
+					canceled_loads.erase(E);
+					loading_count--;
+				}
+				E = N;
+			}
+
+			for (KeyValue<int64_t, Request> &E : requests) {
+				Request &req = E.value;
+				if (req.status != STATUS_LOADING) {
+					continue;
+				}
+
+				float progress = 0.0;
+				ResourceLoader::ThreadLoadStatus load_status = ResourceLoader::load_threaded_get_status(req.path, &progress);
+				if (load_status == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+					req.progress = progress;
+					continue;
+				}
+
+				Error err = OK;
+				req.resource = ResourceLoader::load_threaded_get(req.path, &err);
+				if (load_status == ResourceLoader::THREAD_LOAD_LOADED && req.resource.is_valid()) {
+					req.status = STATUS_LOADED;
+					req.progress = 1.0;
+				} else {
+					req.status = STATUS_FAILED;
+				}
+				loading_count--;
+				finished.push_back(E.key);
+			}
+		}
+
+		_dispatch();
+
+		to_emit = finished;
+		finished.clear();
+	}
+
+	for (int64_t id : to_emit) {
+		emit_signal(SNAME("request_finished"), id);
+	}
+}
+
+void ResourceStreamer::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("request", "path", "type_hint", "priority", "cache_mode"), &ResourceStreamer::request, DEFVAL(""), DEFVAL(0), DEFVAL(ResourceFormatLoader::CACHE_MODE_REUSE));
+	ClassDB::bind_method(D_METHOD("set_priority", "id", "priority"), &ResourceStreamer::set_priority);
+	ClassDB::bind_method(D_METHOD("get_priority", "id"), &ResourceStreamer::get_priority);
+	ClassDB::bind_method(D_METHOD("cancel", "id"), &ResourceStreamer::cancel);
+	ClassDB::bind_method(D_METHOD("get_status", "id"), &ResourceStreamer::get_status);
+	ClassDB::bind_method(D_METHOD("get_progress", "id"), &ResourceStreamer::get_progress);
+	ClassDB::bind_method(D_METHOD("get_resource", "id"), &ResourceStreamer::get_resource);
+	ClassDB::bind_method(D_METHOD("set_max_concurrent_loads", "count"), &ResourceStreamer::set_max_concurrent_loads);
+	ClassDB::bind_method(D_METHOD("get_max_concurrent_loads"), &ResourceStreamer::get_max_concurrent_loads);
+	ClassDB::bind_method(D_METHOD("get_queued_count"), &ResourceStreamer::get_queued_count);
+	ClassDB::bind_method(D_METHOD("get_loading_count"), &ResourceStreamer::get_loading_count);
+	ClassDB::bind_method(D_METHOD("poll"), &ResourceStreamer::poll);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_concurrent_loads", PropertyHint::HINT_RANGE, "1,64,1,or_greater"), "set_max_concurrent_loads", "get_max_concurrent_loads");
+
+	ADD_SIGNAL(MethodInfo("request_finished", PropertyInfo(Variant::INT, "id")));
+
+	BIND_ENUM_CONSTANT(STATUS_INVALID);
+	BIND_ENUM_CONSTANT(STATUS_QUEUED);
+	BIND_ENUM_CONSTANT(STATUS_LOADING);
+	BIND_ENUM_CONSTANT(STATUS_LOADED);
+	BIND_ENUM_CONSTANT(STATUS_FAILED);
+}
+
+ResourceStreamer::ResourceStreamer() {
+	singleton = this;
+}
+
+ResourceStreamer::~ResourceStreamer() {
+	singleton = nullptr;
+}
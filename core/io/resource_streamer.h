@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  resource_streamer.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/resource_loader.h"
+#include "core/object/object.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/sort_array.h"
+
+// Schedules threaded loads on top of ResourceLoader. Requests wait in a queue ordered by
+// priority and only a limited number are handed to ResourceLoader at once, so urgent loads
+// don't compete with a backlog of prefetches.
+class ResourceStreamer : public Object {
+	GDCLASS(ResourceStreamer, Object);
+
+public:
+	enum Status {
+		STATUS_INVALID,
+		STATUS_QUEUED,
+		STATUS_LOADING,
+		STATUS_LOADED,
+		STATUS_FAILED,
+	};
+
+private:
+	struct Request {
+		String path;
+		String type_hint;
+		ResourceFormatLoader::CacheMode cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE;
+		int priority = 0;
+		Status status = STATUS_QUEUED;
+		float progress = 0.0;
+		Ref<Resource> resource;
+	};
+
+	// Queued requests are kept in a binary heap, highest priority first, then oldest first.
+	// Entries aren't removed when their request is canceled or changes priority, they're skipped once they reach the top.
+	struct QueueEntry {
+		int64_t id = 0;
+		int priority = 0;
+	};
+
+	struct QueueEntryComparator {
+		_FORCE_INLINE_ bool operator()(const QueueEntry &p_a, const QueueEntry &p_b) const {
+			return p_a.priority < p_b.priority || (p_a.priority == p_b.priority && p_a.id > p_b.id);
+		}
+	};
+
+	static ResourceStreamer *singleton;
+
+	mutable Mutex mutex;
+	HashMap<int64_t, Request> requests;
+	// In-flight loads that were canceled, kept until ResourceLoader is done with them so their token can be released.
+	List<String> canceled_loads;
+	int64_t last_id = 0;
+	int max_concurrent_loads = 2;
+	int queued_count = 0;
+	int loading_count = 0;
+	// Requests that finished since the last poll, whose signal is still to be emitted.
+	LocalVector<int64_t> finished;
+
+	LocalVector<QueueEntry> queue;
+
+	void _queue_push(int64_t p_id, int p_priority);
+	void _queue_compact();
+	void _dispatch();
+
+protected:
+	static void _bind_methods();
+
+public:
+	static ResourceStreamer *get_singleton() { return singleton; }
+
+	int64_t request(const String &p_path, const String &p_type_hint = "", int p_priority = 0, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
+	void set_priority(int64_t p_id, int p_priority);
+	int get_priority(int64_t p_id) const;
+	void cancel(int64_t p_id);
+
+	Status get_status(int64_t p_id) const;
+	float get_progress(int64_t p_id) const;
+	Ref<Resource> get_resource(int64_t p_id);
+
+	void set_max_concurrent_loads(int p_count);
+	int get_max_concurrent_loads() const;
+
+	int get_queued_count() const;
+	int get_loading_count() const;
+
+	// Called once per frame by the main loop.
+	void poll();
+
+	ResourceStreamer();
+	~ResourceStreamer();
+};
+
+VARIANT_ENUM_CAST(ResourceStreamer::Status);
@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  radix_sort.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/local_vector.h"
+
+// Stable least significant digit radix sort of values by 64-bit keys. Digits that are the same in every key are skipped,
+// so keys that only use some of their bits sort in fewer passes. Large arrays are sorted in parallel on the WorkerThreadPool.
+template <typename T>
+class RadixSort {
+public:
+	struct Element {
+		uint64_t key = 0;
+		T value = T();
+	};
+
+	enum {
+		DIGIT_BITS = 8,
+		DIGIT_COUNT = 1 << DIGIT_BITS,
+		DIGIT_MASK = DIGIT_COUNT - 1,
+		PASS_COUNT = 64 / DIGIT_BITS,
+		PARALLEL_MIN_ELEMENTS_PER_TASK = 16384,
+	};
+
+private:
+	struct Pass {
+		const Element *src = nullptr;
+		Element *dst = nullptr;
+		uint32_t size = 0;
+		uint32_t elements_per_task = 0;
+		uint32_t shift = 0;
+		uint32_t *histograms = nullptr;
+	};
+
+	LocalVector<Element> scratch;
+	LocalVector<uint32_t> histograms;
+
+	void _histogram_task(uint32_t p_task, const Pass *p_pass) {
+		uint32_t *histogram = &p_pass->histograms[p_task * DIGIT_COUNT];
+		memset(histogram, 0, sizeof(uint32_t) * DIGIT_COUNT);
+
+		const uint32_t from = p_task * p_pass->elements_per_task;
+		const uint32_t to = MIN(from + p_pass->elements_per_task, p_pass->size);
+		for (uint32_t i = from; i < to; i++) {
+			histogram[(p_pass->src[i].key >> p_pass->shift) & DIGIT_MASK]++;
+		}
+	}
+
+	void _scatter_task(uint32_t p_task, const Pass *p_pass) {
+		uint32_t *offsets = &p_pass->histograms[p_task * DIGIT_COUNT];
+
+		const uint32_t from = p_task * p_pass->elements_per_task;
+		const uint32_t to = MIN(from + p_pass->elements_per_task, p_pass->size);
+		for (uint32_t i = from; i < to; i++) {
+			const Element &e = p_pass->src[i];
+			p_pass->dst[offsets[(e.key >> p_pass->shift) & DIGIT_MASK]++] = e;
+		}
+	}
+
+public:
+	// Sorts p_elements in place by ascending key. Elements with equal keys keep their relative order, so sorting
+	// by the least significant key first and the most significant key last sorts by keys wider than 64 bits.
+	void sort(Element *p_elements, uint32_t p_size, bool p_allow_parallel = true) {
+		if (p_size < 2) {
+			return;
+		}
+
+		// Only the digits containing bits that differ between keys need a pass.
+		uint64_t differing_bits = 0;
+		const uint64_t first_key = p_elements[0].key;
+		for (uint32_t i = 1; i < p_size; i++) {
+			differing_bits |= p_elements[i].key ^ first_key;
+		}
+
+		if (differing_bits == 0) {
+			return;
+		}
+
+		uint32_t task_count = 1;
+		if (p_allow_parallel && p_size >= PARALLEL_MIN_ELEMENTS_PER_TASK * 2) {
+			task_count = MIN(p_size / PARALLEL_MIN_ELEMENTS_PER_TASK, MAX(uint32_t(WorkerThreadPool::get_singleton()->get_thread_count()), 1U));
+		}
+
+		scratch.resize(p_size);
+		histograms.resize(task_count * DIGIT_COUNT);
+
+		Pass pass;
+		pass.size = p_size;
+		pass.elements_per_task = (p_size + task_count - 1) / task_count;
+		pass.histograms = histograms.ptr();
+
+		Element *src = p_elements;
+		Element *dst = scratch.ptr();
+
+		for (uint32_t i = 0; i < PASS_COUNT; i++) {
+			pass.shift = i * DIGIT_BITS;
+			if (((differing_bits >> pass.shift) & DIGIT_MASK) == 0) {
+				continue;
+			}
+
+			pass.src = src;
+			pass.dst = dst;
+
+			if (task_count > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RadixSort::_histogram_task, (const Pass *)&pass, task_count, -1, true, SNAME("RadixSortHistogram"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				_histogram_task(0, &pass);
+			}
+
+			// Turn the counts into the offset where each task writes its first element of each digit. Tasks write their
+			// elements in the same order as they were read, which keeps the sort stable.
+			uint32_t offset = 0;
+			for (uint32_t digit = 0; digit < DIGIT_COUNT; digit++) {
+				for (uint32_t task = 0; task < task_count; task++) {
+					uint32_t &count = histograms[task * DIGIT_COUNT + digit];
+					const uint32_t digit_count = count;
+					count = offset;
+					offset += digit_count;
+				}
+			}
+
+			if (task_count > 1) {
+				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RadixSort::_scatter_task, (const Pass *)&pass, task_count, -1, true, SNAME("RadixSortScatter"));
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			} else {
+				_scatter_task(0, &pass);
+			}
+
+			SWAP(src, dst);
+		}
+
+		if (src != p_elements) {
+			for (uint32_t i = 0; i < p_size; i++) {
+				p_elements[i] = src[i];
+			}
+		}
+	}
+};
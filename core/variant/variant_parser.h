@@ -51,12 +51,25 @@ public:
 		virtual uint32_t _read_buffer(char32_t *p_buffer, uint32_t p_num_chars) = 0;
 		virtual bool _is_eof() const = 0;
 
+		char32_t _refill_and_get_char();
+
 	public:
 		char32_t saved = 0;
 
-		char32_t get_char();
+		// Inlined, since the tokenizer calls it for every character. Only refilling goes through the virtual read.
+		_FORCE_INLINE_ char32_t get_char() {
+			if (likely(readahead_pointer < readahead_filled)) {
+				return readahead_buffer[readahead_pointer++];
+			}
+			return _refill_and_get_char();
+		}
 		virtual bool is_utf8() const = 0;
-		bool is_eof() const;
+		_FORCE_INLINE_ bool is_eof() const {
+			if (readahead_enabled) {
+				return eof;
+			}
+			return _is_eof();
+		}
 
 		Stream() {}
 		virtual ~Stream() {}
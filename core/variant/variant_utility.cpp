@@ -1196,6 +1196,26 @@ PackedByteArray VariantUtilityFunctions::var_to_bytes_with_objects(const Variant
 	return barr;
 }
 
+PackedByteArray VariantUtilityFunctions::var_to_bytes_compact(const Variant &p_var) {
+	int len;
+	Error err = encode_variant(p_var, nullptr, len, false, 0, true);
+	if (err != OK) {
+		return PackedByteArray();
+	}
+
+	PackedByteArray barr;
+	barr.resize(len);
+	{
+		uint8_t *w = barr.ptrw();
+		err = encode_variant(p_var, w, len, false, 0, true);
+		if (err != OK) {
+			return PackedByteArray();
+		}
+	}
+
+	return barr;
+}
+
 Variant VariantUtilityFunctions::bytes_to_var(const PackedByteArray &p_arr) {
 	Variant ret;
 	{
@@ -1867,6 +1887,7 @@ void Variant::_register_variant_utility_functions() {
 	FUNCBINDR(bytes_to_var, sarray("bytes"), Variant::UTILITY_FUNC_TYPE_GENERAL);
 
 	FUNCBINDR(var_to_bytes_with_objects, sarray("variable"), Variant::UTILITY_FUNC_TYPE_GENERAL);
+	FUNCBINDR(var_to_bytes_compact, sarray("variable"), Variant::UTILITY_FUNC_TYPE_GENERAL);
 	FUNCBINDR(bytes_to_var_with_objects, sarray("bytes"), Variant::UTILITY_FUNC_TYPE_GENERAL);
 
 	FUNCBINDR(hash, sarray("variable"), Variant::UTILITY_FUNC_TYPE_GENERAL);
@@ -353,6 +353,8 @@ RasterizerGLES3::RasterizerGLES3() {
 
 				if (!shader_cache_dir.is_empty()) {
 					ShaderGLES3::set_shader_cache_dir(shader_cache_dir);
+					uint64_t compiler_cache_max_size = uint64_t(int(GLOBAL_GET("rendering/shader_compiler/shader_cache/generated_code_max_size_mb"))) * 1024 * 1024;
+					ShaderCompiler::set_cache_dir(shader_cache_dir, compiler_cache_max_size);
 				}
 			}
 		}
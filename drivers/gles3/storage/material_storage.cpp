@@ -2333,6 +2333,11 @@ RS::ShaderNativeSourceCode MaterialStorage::shader_get_native_source_code(RID p_
 	return RS::ShaderNativeSourceCode();
 }
 
+uint32_t MaterialStorage::shader_precompile_variants() {
+	// Shaders are compiled by the OpenGL driver and cached on first use, there's nothing to compile ahead of time.
+	return 0;
+}
+
 /* MATERIAL API */
 
 void MaterialStorage::_material_queue_update(GLES3::Material *material, bool p_uniform, bool p_texture) {
@@ -588,6 +588,7 @@ public:
 	virtual Variant shader_get_parameter_default(RID p_shader, const StringName &p_name) const override;
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override;
+	virtual uint32_t shader_precompile_variants() override;
 
 	/* MATERIAL API */
 
@@ -2043,6 +2043,53 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+
+	// The buffer uses the RenderingServer layout, colors and custom data are packed to half floats in the data cache.
+	uint32_t src_stride = multimesh->xform_format == RS::MULTIMESH_TRANSFORM_2D ? 8 : 12;
+	uint32_t xform_size = src_stride;
+	src_stride += multimesh->uses_colors ? 4 : 0;
+	src_stride += multimesh->uses_custom_data ? 4 : 0;
+	ERR_FAIL_COND(p_buffer.size() % src_stride != 0);
+	int instance_count = p_buffer.size() / src_stride;
+	ERR_FAIL_COND(p_from_instance < 0 || p_from_instance + instance_count > multimesh->instances);
+	if (instance_count == 0) {
+		return;
+	}
+
+	_multimesh_make_local(multimesh);
+
+	const float *r = p_buffer.ptr();
+	float *w = multimesh->data_cache.ptrw() + p_from_instance * multimesh->stride_cache;
+
+	if (!multimesh->uses_colors && !multimesh->uses_custom_data) {
+		memcpy(w, r, p_buffer.size() * sizeof(float));
+	} else {
+		for (int i = 0; i < instance_count; i++) {
+			const float *dataptr = r + i * src_stride;
+			float *newptr = w + i * multimesh->stride_cache;
+			memcpy(newptr, dataptr, xform_size * sizeof(float));
+
+			if (multimesh->uses_colors) {
+				const float *color = dataptr + xform_size;
+				uint16_t val[4] = { Math::make_half_float(color[0]), Math::make_half_float(color[1]), Math::make_half_float(color[2]), Math::make_half_float(color[3]) };
+				memcpy(newptr + multimesh->color_offset_cache, val, 2 * 4);
+			}
+			if (multimesh->uses_custom_data) {
+				const float *custom_data = dataptr + xform_size + (multimesh->uses_colors ? 4 : 0);
+				uint16_t val[4] = { Math::make_half_float(custom_data[0]), Math::make_half_float(custom_data[1]), Math::make_half_float(custom_data[2]), Math::make_half_float(custom_data[3]) };
+				memcpy(newptr + multimesh->custom_data_offset_cache, val, 2 * 4);
+			}
+		}
+	}
+
+	for (int i = p_from_instance; i < p_from_instance + instance_count; i += MULTIMESH_DIRTY_REGION_SIZE - (i % MULTIMESH_DIRTY_REGION_SIZE)) {
+		_multimesh_mark_dirty(multimesh, i, true);
+	}
+}
+
 RID MeshStorage::_multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	ERR_FAIL_V_MSG(RID(), "GLES3 does not implement indirect multimeshes.");
 }
@@ -2173,7 +2220,11 @@ void MeshStorage::_update_dirty_multimeshes() {
 
 				GLint region_size = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * sizeof(float);
 
-				if (multimesh->data_cache_used_dirty_regions > 32 || multimesh->data_cache_used_dirty_regions > visible_region_count / 2) {
+				// Adjacent dirty regions are uploaded together.
+				MultiMeshDirtyRun dirty_runs[MULTIMESH_MAX_DIRTY_RUNS];
+				int dirty_run_count = multimesh_get_dirty_runs(multimesh->data_cache_dirty_regions, nullptr, visible_region_count, dirty_runs);
+
+				if (dirty_run_count < 0 || multimesh->data_cache_used_dirty_regions > visible_region_count / 2) {
 					// If there too many dirty regions, or represent the majority of regions, just copy all, else transfer cost piles up too much
 					glBindBuffer(GL_ARRAY_BUFFER, multimesh->buffer);
 					glBufferSubData(GL_ARRAY_BUFFER, 0, MIN(visible_region_count * region_size, multimesh->instances * multimesh->stride_cache * sizeof(float)), data);
@@ -2182,13 +2233,11 @@ void MeshStorage::_update_dirty_multimeshes() {
 					// Not that many regions? update them all
 					// TODO: profile the performance cost on low end
 					glBindBuffer(GL_ARRAY_BUFFER, multimesh->buffer);
-					for (uint32_t i = 0; i < visible_region_count; i++) {
-						if (multimesh->data_cache_dirty_regions[i]) {
-							GLint offset = i * region_size;
-							GLint size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
-							uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * i;
-							glBufferSubData(GL_ARRAY_BUFFER, offset, MIN(region_size, size - offset), &data[region_start_index]);
-						}
+					GLint size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
+					for (int i = 0; i < dirty_run_count; i++) {
+						GLint offset = dirty_runs[i].from_region * region_size;
+						uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * dirty_runs[i].from_region;
+						glBufferSubData(GL_ARRAY_BUFFER, offset, MIN(GLint(dirty_runs[i].region_count) * region_size, size - offset), &data[region_start_index]);
 					}
 					glBindBuffer(GL_ARRAY_BUFFER, 0);
 				}
@@ -2302,6 +2351,20 @@ int MeshStorage::skeleton_get_bone_count(RID p_skeleton) const {
 	return skeleton->size;
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * (skeleton->use_2d ? 8 : 12));
+	if (p_buffer.is_empty()) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
@@ -65,8 +65,10 @@
 #include "scene/gui/tab_container.h"
 #include "scene/main/window.h"
 #include "scene/property_utils.h"
+#include "scene/resources/canvas_item_material.h"
 #include "scene/resources/image_texture.h"
 #include "scene/resources/packed_scene.h"
+#include "scene/resources/particle_process_material.h"
 #include "scene/resources/portable_compressed_texture.h"
 #include "scene/theme/theme_db.h"
 #include "servers/display_server.h"
@@ -156,6 +158,7 @@
 #include "editor/plugins/plugin_config_dialog.h"
 #include "editor/plugins/root_motion_editor_plugin.h"
 #include "editor/plugins/script_text_editor.h"
+#include "editor/plugins/shader_cache_export_plugin.h"
 #include "editor/plugins/text_editor.h"
 #include "editor/plugins/version_control_editor_plugin.h"
 #include "editor/plugins/visual_shader_editor_plugin.h"
@@ -1091,6 +1094,13 @@ void EditorNode::_fs_changed() {
 
 	_mark_unsaved_scenes();
 
+	// Like exporting, shader precompilation must wait for the first scan so all resources are imported.
+	if (precompile_shaders_defer && !EditorFileSystem::get_singleton()->is_scanning()) {
+		precompile_shaders_defer = false;
+		_exit_editor(_precompile_shaders() == OK ? EXIT_SUCCESS : EXIT_FAILURE);
+		return;
+	}
+
 	// FIXME: Move this to a cleaner location, it's hacky to do this in _fs_changed.
 	String export_error;
 	Error err = OK;
@@ -5419,6 +5429,52 @@ Error EditorNode::export_preset(const String &p_preset, const String &p_path, bo
 	return OK;
 }
 
+void EditorNode::precompile_shaders() {
+	precompile_shaders_defer = true;
+	cmdline_mode = true;
+}
+
+void EditorNode::_precompile_shaders_load_resources(EditorFileSystemDirectory *p_dir, LocalVector<Ref<Resource>> &r_resources) {
+	for (int i = 0; i < p_dir->get_subdir_count(); i++) {
+		_precompile_shaders_load_resources(p_dir->get_subdir(i), r_resources);
+	}
+
+	for (int i = 0; i < p_dir->get_file_count(); i++) {
+		const StringName type = p_dir->get_file_type(i);
+		if (!ClassDB::is_parent_class(type, "Material") && !ClassDB::is_parent_class(type, "Shader") && !ClassDB::is_parent_class(type, "Mesh") && !ClassDB::is_parent_class(type, "PackedScene")) {
+			continue;
+		}
+
+		Ref<Resource> res = ResourceLoader::load(p_dir->get_file_path(i));
+		if (res.is_valid()) {
+			r_resources.push_back(res);
+		}
+	}
+}
+
+Error EditorNode::_precompile_shaders() {
+	if (RenderingServer::get_singleton()->get_rendering_device() == nullptr) {
+		ERR_PRINT("Shader precompilation requires the Forward+ or Mobile renderer. It can't be used with the Compatibility renderer or --headless.");
+		return ERR_UNAVAILABLE;
+	}
+
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+
+	// Keep every resource that can create materials alive until the shaders are compiled.
+	LocalVector<Ref<Resource>> resources;
+	_precompile_shaders_load_resources(EditorFileSystem::get_singleton()->get_filesystem(), resources);
+
+	// Built-in materials only create their shaders once their pending changes are flushed.
+	BaseMaterial3D::flush_changes();
+	CanvasItemMaterial::flush_changes();
+	ParticleProcessMaterial::flush_changes();
+
+	const uint32_t version_count = RenderingServer::get_singleton()->shader_precompile_variants();
+	print_line(vformat("Precompiled %d shader versions from %d resources in %.2f seconds.", version_count, resources.size(), double(OS::get_singleton()->get_ticks_usec() - begin_usec) / 1000000.0));
+
+	return OK;
+}
+
 bool EditorNode::is_project_exporting() const {
 	return project_export && project_export->is_exporting();
 }
@@ -8285,6 +8341,11 @@ EditorNode::EditorNode() {
 
 	EditorExport::get_singleton()->add_export_plugin(dedicated_server_export_plugin);
 
+	Ref<ShaderCacheExportPlugin> shader_cache_export_plugin;
+	shader_cache_export_plugin.instantiate();
+
+	EditorExport::get_singleton()->add_export_plugin(shader_cache_export_plugin);
+
 	Ref<PackedSceneEditorTranslationParserPlugin> packed_scene_translation_parser_plugin;
 	packed_scene_translation_parser_plugin.instantiate();
 	EditorTranslationParser::get_singleton()->add_parser(packed_scene_translation_parser_plugin, EditorTranslationParser::STANDARD);
@@ -76,6 +76,7 @@ class EditorExport;
 class EditorExportPreset;
 class EditorFeatureProfileManager;
 class EditorFileDialog;
+class EditorFileSystemDirectory;
 class EditorFolding;
 class EditorLayoutsDialog;
 class EditorLog;
@@ -247,6 +248,8 @@ private:
 		Vector<String> patches;
 	} export_defer;
 
+	bool precompile_shaders_defer = false;
+
 	static EditorNode *singleton;
 
 	EditorData editor_data;
@@ -549,6 +552,8 @@ private:
 	void _plugin_over_self_own(EditorPlugin *p_plugin);
 
 	void _fs_changed();
+	void _precompile_shaders_load_resources(EditorFileSystemDirectory *p_dir, LocalVector<Ref<Resource>> &r_resources);
+	Error _precompile_shaders();
 	void _resources_reimporting(const Vector<String> &p_resources);
 	void _resources_reimported(const Vector<String> &p_resources);
 	void _sources_changed(bool p_exist);
@@ -911,6 +916,7 @@ public:
 	void _copy_warning(const String &p_str);
 
 	Error export_preset(const String &p_preset, const String &p_path, bool p_debug, bool p_pack_only, bool p_android_build_template, bool p_patch, const Vector<String> &p_patches);
+	void precompile_shaders();
 	bool is_project_exporting() const;
 
 	Control *get_gui_base() { return gui_base; }
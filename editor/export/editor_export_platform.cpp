@@ -39,6 +39,7 @@
 #include "core/extension/gdextension.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/pack_path_index.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_uid.h"
 #include "core/io/zip_io.h"
@@ -2077,6 +2078,26 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 		fae.unref();
 	}
 
+	// Prebuilt path index, lets the pack be mounted without parsing the directory.
+	// Not written for encrypted directories, since it would expose the file paths.
+	Vector<uint8_t> path_index;
+	if (!(pack_flags & PACK_DIR_ENCRYPTED)) {
+		Vector<PackPathIndex::Source> index_sources;
+		index_sources.resize(pd.file_ofs.size());
+		for (int i = 0; i < pd.file_ofs.size(); i++) {
+			PackPathIndex::Source &src = index_sources.write[i];
+			src.path = String::utf8(pd.file_ofs[i].path_utf8.get_data(), pd.file_ofs[i].path_utf8.length());
+			src.ofs = pd.file_ofs[i].ofs;
+			src.size = pd.file_ofs[i].size;
+			src.md5 = pd.file_ofs[i].md5.ptr();
+			src.flags = (pd.file_ofs[i].encrypted ? PACK_FILE_ENCRYPTED : 0) | (pd.file_ofs[i].removal ? PACK_FILE_REMOVAL : 0);
+		}
+		path_index = PackPathIndex::build(index_sources);
+	}
+
+	uint64_t path_index_ofs = f->get_position();
+	f->store_buffer(path_index);
+
 	int header_padding = _get_pad(PCK_PADDING, f->get_position());
 	for (int i = 0; i < header_padding; i++) {
 		f->store_8(0);
@@ -2086,9 +2107,16 @@ Error EditorExportPlatform::save_pack(const Ref<EditorExportPreset> &p_preset, b
 	uint64_t file_base_store = file_base;
 	if (pack_flags & PACK_REL_FILEBASE) {
 		file_base_store -= pck_start_pos;
+		path_index_ofs -= pck_start_pos;
 	}
 	f->seek(file_base_ofs);
 	f->store_64(file_base_store); // update files base
+	if (!path_index.is_empty()) {
+		f->store_64(path_index_ofs);
+		f->store_64(path_index.size());
+		f->seek(file_base_ofs - 4);
+		f->store_32(pack_flags | PACK_PATH_INDEX); // update flags
+	}
 	f->seek(file_base);
 
 	// Save the rest of the data.
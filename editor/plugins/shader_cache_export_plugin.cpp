@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*  shader_cache_export_plugin.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "shader_cache_export_plugin.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "servers/rendering/renderer_compositor.h"
+
+String ShaderCacheExportPlugin::_get_precompiled_cache_dir() const {
+	String path = get_option("shader_cache/precompiled_path");
+	if (path.is_relative_path()) {
+		path = "res://" + path;
+	}
+
+	// The renderer stores its cache in a subfolder of the shader cache path.
+	return path.path_join("shader_cache");
+}
+
+void ShaderCacheExportPlugin::_add_cache_dir(const String &p_from, const String &p_to) {
+	Ref<DirAccess> da = DirAccess::open(p_from);
+	ERR_FAIL_COND_MSG(da.is_null(), "Can't open the precompiled shader cache folder: " + p_from);
+
+	for (const String &dir : da->get_directories()) {
+		_add_cache_dir(p_from.path_join(dir), p_to.path_join(dir));
+	}
+
+	for (const String &file : da->get_files()) {
+		add_file(p_to.path_join(file), FileAccess::get_file_as_bytes(p_from.path_join(file)), false);
+	}
+}
+
+void ShaderCacheExportPlugin::_get_export_options(const Ref<EditorExportPlatform> &p_platform, List<EditorExportPlatform::ExportOption> *r_options) const {
+	r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::BOOL, "shader_cache/include_precompiled"), false));
+	r_options->push_back(EditorExportPlatform::ExportOption(PropertyInfo(Variant::STRING, "shader_cache/precompiled_path", PropertyHint::HINT_GLOBAL_DIR), "res://.godot/precompiled_shaders"));
+}
+
+String ShaderCacheExportPlugin::_get_export_option_warning(const Ref<EditorExportPlatform> &p_platform, const String &p_option_name) const {
+	if (p_option_name == "shader_cache/precompiled_path" && bool(get_option("shader_cache/include_precompiled")) && !DirAccess::dir_exists_absolute(_get_precompiled_cache_dir())) {
+		return TTR("No precompiled shader cache was found in this folder. Run the editor with \"--precompile-shaders <path>\" first.");
+	}
+	return String();
+}
+
+void ShaderCacheExportPlugin::_export_begin(const HashSet<String> &p_features, bool p_debug, const String &p_path, int p_flags) {
+	if (!bool(get_option("shader_cache/include_precompiled"))) {
+		return;
+	}
+
+	const String cache_dir = _get_precompiled_cache_dir();
+	ERR_FAIL_COND_MSG(!DirAccess::dir_exists_absolute(cache_dir), "No precompiled shader cache was found in: " + cache_dir);
+
+	_add_cache_dir(cache_dir, RendererCompositor::PRECOMPILED_SHADER_CACHE_PATH);
+}
@@ -48,6 +48,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/ip.h"
 #include "core/io/resource_loader.h"
+#include "core/io/resource_streamer.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
@@ -222,6 +223,7 @@ static bool auto_build_solutions = false;
 static String debug_server_uri;
 static bool wait_for_import = false;
 static bool restore_editor_window_layout = true;
+static String precompile_shaders_path;
 #ifndef DISABLE_DEPRECATED
 static int converter_max_kb_file = 4 * 1024; // 4MB
 static int converter_max_line_length = 100000;
@@ -667,6 +669,9 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--check-only", "Only parse for errors and quit (use with --script).\n");
 #ifdef TOOLS_ENABLED
 	print_help_option("--import", "Starts the editor, waits for any resources to be imported, and then quits.\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("--precompile-shaders [<path>]", "Starts the editor, waits for any resources to be imported, compiles the shaders of all the project's materials, meshes and scenes into the shader cache, and then quits.\n", CLI_OPTION_AVAILABILITY_EDITOR);
+	print_help_option("", "If <path> is given, the shader cache is written to that folder instead of the editor's, so it can be included in exports (see the \"Shader Cache\" export options). <path> can be relative to the project directory.\n");
+	print_help_option("", "Requires the Forward+ or Mobile renderer, so it can't be combined with --headless. On CI, use a software Vulkan driver such as lavapipe.\n");
 	print_help_option("--export-release <preset> <path>", "Export the project in release mode using the given preset and output path. The preset name should match one defined in \"export_presets.cfg\".\n", CLI_OPTION_AVAILABILITY_EDITOR);
 	print_help_option("", "<path> should be absolute or relative to the project directory, and include the filename for the binary (e.g. \"builds/game.exe\").\n");
 	print_help_option("", "The target directory must exist.\n");
@@ -1548,6 +1553,17 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			cmdline_tool = true;
 			wait_for_import = true;
 			quit_after = 1;
+		} else if (arg == "--precompile-shaders") {
+			// Actually handling is done in start().
+			editor = true;
+			cmdline_tool = true;
+			wait_for_import = true;
+			main_args.push_back(arg);
+
+			if (N && !N->get().begins_with("-") && !N->get().ends_with("project.godot")) {
+				precompile_shaders_path = N->get();
+				N = N->next();
+			}
 		} else if (arg == "--export-release" || arg == "--export-debug" ||
 				arg == "--export-pack" || arg == "--export-patch") { // Export project
 			// Actually handling is done in start().
@@ -2899,6 +2915,16 @@ Error Main::setup2(bool p_show_boot_logo) {
 
 		EditorPaths::create();
 
+		if (!precompile_shaders_path.is_empty()) {
+			// Write the precompiled shaders to their own folder, so they can be exported without the editor's shaders.
+			if (precompile_shaders_path.is_relative_path()) {
+				precompile_shaders_path = ProjectSettings::get_singleton()->get_resource_path().path_join(precompile_shaders_path);
+			}
+			Error err = DirAccess::make_dir_recursive_absolute(precompile_shaders_path);
+			ERR_FAIL_COND_V_MSG(err != OK, err, "Can't create the shader precompilation folder: " + precompile_shaders_path);
+			Engine::get_singleton()->set_shader_cache_path(precompile_shaders_path);
+		}
+
 		// Editor setting class is not available, load config directly.
 		if (!init_use_custom_screen && (editor || project_manager) && EditorPaths::get_singleton()->are_paths_valid()) {
 			ERR_FAIL_COND_V(!DirAccess::dir_exists_absolute(EditorPaths::get_singleton()->get_config_dir()), FAILED);
@@ -3806,6 +3832,7 @@ int Main::start() {
 	bool export_pack_only = false;
 	bool install_android_build_template = false;
 	bool export_patch = false;
+	bool precompile_shaders = false;
 #ifdef MODULE_GDSCRIPT_ENABLED
 	String gdscript_docs_path;
 #endif
@@ -3831,6 +3858,8 @@ int Main::start() {
 		} else if (E->get() == "--gdextension-docs") {
 			gen_flags.set_flag(DocTools::GENERATE_FLAG_SKIP_BASIC_TYPES);
 			gen_flags.set_flag(DocTools::GENERATE_FLAG_EXTENSION_CLASSES_ONLY);
+		} else if (E->get() == "--precompile-shaders") {
+			precompile_shaders = true;
 #ifndef DISABLE_DEPRECATED
 		} else if (E->get() == "--convert-3to4") {
 			converting_project = true;
@@ -4338,6 +4367,9 @@ int Main::start() {
 			if (!_export_preset.is_empty()) {
 				editor_node->export_preset(_export_preset, positional_arg, export_debug, export_pack_only, install_android_build_template, export_patch, patches);
 				game_path = ""; // Do not load anything.
+			} else if (precompile_shaders) {
+				editor_node->precompile_shaders();
+				game_path = ""; // Do not load anything.
 			}
 
 			OS::get_singleton()->benchmark_end_measure("Startup", "Editor");
@@ -4727,6 +4759,9 @@ bool Main::iteration() {
 
 	uint64_t process_begin = OS::get_singleton()->get_ticks_usec();
 
+	// Finished loads are reported before processing, so scripts can use them this frame.
+	ResourceStreamer::get_singleton()->poll();
+
 	if (OS::get_singleton()->get_main_loop()->process(process_step * time_scale)) {
 		exit = true;
 	}
@@ -32,6 +32,7 @@
 
 #include "performance.h"
 
+#include "core/io/resource_streamer.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -131,6 +132,10 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_QUEUED);
+	BIND_ENUM_CONSTANT(RESOURCE_STREAMING_LOADING);
+	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_IN_FRAME);
+	BIND_ENUM_CONSTANT(PIPELINE_COMPILATION_STALL_TIME);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -211,6 +216,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("resource_streaming/queued"),
+		PNAME("resource_streaming/loading"),
+		PNAME("pipeline/compilations_in_frame"),
+		PNAME("pipeline/compilation_stall_time"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -434,6 +443,14 @@ double Performance::get_monitor(Monitor p_monitor) const {
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+		case RESOURCE_STREAMING_QUEUED:
+			return ResourceStreamer::get_singleton()->get_queued_count();
+		case RESOURCE_STREAMING_LOADING:
+			return ResourceStreamer::get_singleton()->get_loading_count();
+		case PIPELINE_COMPILATIONS_IN_FRAME:
+			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_IN_FRAME);
+		case PIPELINE_COMPILATION_STALL_TIME:
+			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATION_STALL_TIME) / 1000000.0;
 
 		default: {
 		}
@@ -505,6 +522,10 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -127,6 +127,10 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		RESOURCE_STREAMING_QUEUED,
+		RESOURCE_STREAMING_LOADING,
+		PIPELINE_COMPILATIONS_IN_FRAME,
+		PIPELINE_COMPILATION_STALL_TIME,
 		MONITOR_MAX
 	};
 
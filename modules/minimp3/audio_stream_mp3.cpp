@@ -41,6 +41,10 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		return 0;
 	}
 
+	if (seek_pending) {
+		seek(double(frames_mixed) / mp3_stream->sample_rate);
+	}
+
 	int todo = p_frames;
 
 	int frames_mixed_this_step = p_frames;
@@ -101,6 +105,49 @@ int AudioStreamPlaybackMP3::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 	return frames_mixed_this_step;
 }
 
+int AudioStreamPlaybackMP3::_skip_internal(int p_frames) {
+	if (!active) {
+		return 0;
+	}
+
+	int64_t end_frame = mp3_stream->get_length() * mp3_stream->sample_rate;
+	if (end_frame <= 0) {
+		return AudioStreamPlaybackResampled::_skip_internal(p_frames);
+	}
+
+	bool use_loop = looping_override ? looping : mp3_stream->loop;
+	if (use_loop && mp3_stream->get_bpm() > 0 && mp3_stream->get_beat_count() > 0) {
+		end_frame = MIN(end_frame, int64_t(mp3_stream->get_beat_count() * mp3_stream->sample_rate * 60 / mp3_stream->get_bpm()));
+	}
+
+	// Only move the position, the seek happens once the stream is mixed again.
+	int64_t position = int64_t(frames_mixed) + p_frames;
+	seek_pending = true;
+	loop_fade_remaining = FADE_SIZE;
+
+	if (position < end_frame) {
+		frames_mixed = position;
+		return p_frames;
+	}
+
+	if (!use_loop) {
+		int skipped = MAX(end_frame - int64_t(frames_mixed), int64_t(0));
+		frames_mixed = end_frame;
+		active = false;
+		return skipped;
+	}
+
+	int64_t loop_begin = mp3_stream->loop_offset * mp3_stream->sample_rate;
+	if (loop_begin >= end_frame) {
+		loop_begin = 0;
+	}
+	int64_t loop_length = end_frame - loop_begin;
+	int64_t overflow = position - end_frame;
+	loops += 1 + overflow / loop_length;
+	frames_mixed = loop_begin + overflow % loop_length;
+	return p_frames;
+}
+
 float AudioStreamPlaybackMP3::get_stream_sampling_rate() {
 	return mp3_stream->sample_rate;
 }
@@ -133,6 +180,8 @@ void AudioStreamPlaybackMP3::seek(double p_time) {
 		return;
 	}
 
+	seek_pending = false;
+
 	if (p_time >= mp3_stream->get_length()) {
 		p_time = 0;
 	}
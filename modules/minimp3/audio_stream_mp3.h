@@ -52,6 +52,7 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 	mp3dec_ex_t mp3d = {};
 	uint32_t frames_mixed = 0;
 	bool active = false;
+	bool seek_pending = false; // Skipped ahead without decoding, seek to `frames_mixed` before the next mix.
 	int loops = 0;
 
 	friend class AudioStreamMP3;
@@ -63,6 +64,7 @@ class AudioStreamPlaybackMP3 : public AudioStreamPlaybackResampled {
 
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
+	virtual int _skip_internal(int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
 public:
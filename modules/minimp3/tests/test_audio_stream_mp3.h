@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_audio_stream_mp3.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../audio_stream_mp3.h"
+
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStreamMP3 {
+
+constexpr int MP3_FRAME_SIZE = 417; // Bytes in a 128 kbps, 44.1 kHz frame without padding.
+constexpr int MP3_FRAME_SAMPLES = 1152;
+constexpr int BLOCK_SIZE = 512;
+
+// Generates mono MPEG-1 Layer III frames whose side information is all zeros, which decode to silence.
+// The playback position is all the skipping tests look at, so no encoder is needed.
+Vector<uint8_t> gen_silent_mp3(int p_frame_count) {
+	Vector<uint8_t> data;
+	data.resize(p_frame_count * MP3_FRAME_SIZE);
+	data.fill(0);
+
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < p_frame_count; i++) {
+		uint8_t *frame = &w[i * MP3_FRAME_SIZE];
+		frame[0] = 0xFF; // Frame sync.
+		frame[1] = 0xFB; // MPEG-1, Layer III, no CRC.
+		frame[2] = 0x90; // 128 kbps, 44.1 kHz, no padding.
+		frame[3] = 0xC0; // Mono.
+	}
+	return data;
+}
+
+int get_block_count_for_length(const Ref<AudioStreamMP3> &p_stream, double p_factor) {
+	return Math::ceil(p_stream->get_length() * AudioServer::get_singleton()->get_mix_rate() * p_factor / BLOCK_SIZE);
+}
+
+TEST_CASE("[Audio][AudioStreamMP3] Skipping matches mixing") {
+	Ref<AudioStreamMP3> stream;
+	stream.instantiate();
+	stream->set_data(gen_silent_mp3(40));
+	REQUIRE(stream->get_length() == doctest::Approx(40.0 * MP3_FRAME_SAMPLES / 44100.0));
+
+	Ref<AudioStreamPlayback> mixed_playback = stream->instantiate_playback();
+	Ref<AudioStreamPlayback> skipped_playback = stream->instantiate_playback();
+	mixed_playback->start();
+	skipped_playback->start();
+
+	Vector<AudioFrame> buffer;
+	buffer.resize(BLOCK_SIZE);
+
+	for (int i = 0; i < 16; i++) {
+		CHECK(mixed_playback->mix(buffer.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+		CHECK(skipped_playback->skip(1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	}
+
+	// The skipped playback seeks to its new position when it's mixed again.
+	// Positions may differ by the frames buffered for resampling, a few milliseconds.
+	CHECK(mixed_playback->mix(buffer.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(skipped_playback->mix(buffer.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(Math::abs(skipped_playback->get_playback_position() - mixed_playback->get_playback_position()) < 0.01);
+	CHECK(skipped_playback->is_playing());
+
+	SUBCASE("Skipping past the end stops the playback") {
+		int skipped = 0;
+		for (int i = 0; i < get_block_count_for_length(stream, 2.0); i++) {
+			skipped = skipped_playback->skip(1.0, BLOCK_SIZE);
+			if (skipped != BLOCK_SIZE) {
+				break;
+			}
+		}
+		CHECK(skipped < BLOCK_SIZE);
+		CHECK_FALSE(skipped_playback->is_playing());
+		CHECK(skipped_playback->get_loop_count() == 0);
+	}
+}
+
+TEST_CASE("[Audio][AudioStreamMP3] Skipping past the end wraps around when looping") {
+	Ref<AudioStreamMP3> stream;
+	stream.instantiate();
+	stream->set_data(gen_silent_mp3(40));
+	stream->set_loop(true);
+	stream->set_loop_offset(0.5);
+
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	playback->start();
+
+	// Skip one and a quarter times the length of the stream.
+	bool skipped_all = true;
+	for (int i = 0; i < get_block_count_for_length(stream, 1.25); i++) {
+		skipped_all = skipped_all && playback->skip(1.0, BLOCK_SIZE) == BLOCK_SIZE;
+	}
+	CHECK(skipped_all);
+	CHECK(playback->is_playing());
+	CHECK(playback->get_loop_count() == 1);
+	CHECK(playback->get_playback_position() >= 0.5);
+	CHECK(playback->get_playback_position() < stream->get_length());
+
+	Vector<AudioFrame> buffer;
+	buffer.resize(BLOCK_SIZE);
+	CHECK(playback->mix(buffer.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(playback->get_playback_position() >= 0.5);
+}
+
+} // namespace TestAudioStreamMP3
@@ -122,6 +122,7 @@ private:
 
 	NodePath root_path;
 	bool allow_object_decoding = false;
+	bool compact_rpc_encoding = false;
 	bool server_relay = true;
 	Ref<StreamPeerBuffer> relay_buffer;
 
@@ -193,6 +194,9 @@ public:
 	void set_allow_object_decoding(bool p_enable);
 	bool is_object_decoding_allowed() const;
 
+	void set_compact_rpc_encoding(bool p_enable);
+	bool is_compact_rpc_encoding() const;
+
 	void set_server_relay_enabled(bool p_enabled);
 	bool is_server_relay_enabled() const;
 
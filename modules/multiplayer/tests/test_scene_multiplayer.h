@@ -64,12 +64,42 @@ TEST_CASE("[Multiplayer][SceneMultiplayer] Defaults") {
 	CHECK(scene_multiplayer->get_connected_peers().is_empty());
 	CHECK_FALSE(scene_multiplayer->is_refusing_new_connections());
 	CHECK_FALSE(scene_multiplayer->is_object_decoding_allowed());
+	CHECK_FALSE(scene_multiplayer->is_compact_rpc_encoding());
 	CHECK(scene_multiplayer->is_server_relay_enabled());
 	CHECK_EQ(scene_multiplayer->get_max_sync_packet_size(), 1350);
 	CHECK_EQ(scene_multiplayer->get_max_delta_packet_size(), 65535);
 	CHECK(scene_multiplayer->is_server());
 }
 
+TEST_CASE("[Multiplayer][SceneMultiplayer] Compact RPC argument encoding") {
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Ref<Script>());
+	ints.push_back(1);
+	ints.push_back(2);
+	const Variant arg0 = ints;
+	const Variant arg1 = 3;
+	const Variant *args[2] = { &arg0, &arg1 };
+
+	int len = 0;
+	int compact_len = 0;
+	CHECK_EQ(MultiplayerAPI::encode_and_compress_variants(args, 2, nullptr, len), Error::OK);
+	CHECK_EQ(MultiplayerAPI::encode_and_compress_variants(args, 2, nullptr, compact_len, nullptr, false, true), Error::OK);
+	CHECK_LT(compact_len, len);
+
+	Vector<uint8_t> buffer;
+	buffer.resize(compact_len);
+	CHECK_EQ(MultiplayerAPI::encode_and_compress_variants(args, 2, buffer.ptrw(), compact_len, nullptr, false, true), Error::OK);
+
+	Vector<Variant> decoded;
+	int r_len = 0;
+	decoded.resize(2);
+	CHECK_EQ(MultiplayerAPI::decode_and_decompress_variants(decoded, buffer.ptr(), buffer.size(), r_len), Error::OK);
+	CHECK_EQ(r_len, compact_len);
+	CHECK_EQ(decoded[0], arg0);
+	CHECK_EQ(Array(decoded[0]).get_typed_builtin(), Variant::INT);
+	CHECK_EQ(decoded[1], arg1);
+}
+
 TEST_CASE("[Multiplayer][SceneMultiplayer][SceneTree] SceneTree has a OfflineMultiplayerPeer by default") {
 	Ref<SceneMultiplayer> scene_multiplayer = SceneTree::get_singleton()->get_multiplayer();
 	REQUIRE(scene_multiplayer->has_multiplayer_peer());
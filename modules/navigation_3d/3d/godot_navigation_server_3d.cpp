@@ -1377,6 +1377,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	int _new_pm_path_cache_hit_count = 0;
+	int _new_pm_path_cache_miss_count = 0;
+	int _new_pm_path_cache_time_saved = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
@@ -1393,6 +1396,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_path_cache_hit_count += active_maps[i]->get_pm_path_cache_hit_count();
+		_new_pm_path_cache_miss_count += active_maps[i]->get_pm_path_cache_miss_count();
+		_new_pm_path_cache_time_saved += active_maps[i]->get_pm_path_cache_time_saved();
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1404,6 +1410,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_path_cache_hit_count = _new_pm_path_cache_hit_count;
+	pm_path_cache_miss_count = _new_pm_path_cache_miss_count;
+	pm_path_cache_time_saved = _new_pm_path_cache_time_saved;
 }
 
 void GodotNavigationServer3D::init() {
@@ -1431,6 +1440,37 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_paths(const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results) {
+	ERR_FAIL_COND_MSG(p_query_parameters.size() != p_query_results.size(), "The number of query parameters and query results must match.");
+
+	// Group the queries per map so each map runs its share of the batch against a single iteration snapshot.
+	HashMap<NavMap3D *, LocalVector<uint32_t>> map_query_indices;
+
+	for (int i = 0; i < p_query_parameters.size(); i++) {
+		const Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[i];
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[i];
+		ERR_CONTINUE(query_result.is_null());
+
+		// Skipped queries return an empty path instead of keeping the result of a previous batch.
+		if (query_parameters.is_null()) {
+			query_result->reset();
+			ERR_CONTINUE(query_parameters.is_null());
+		}
+
+		NavMap3D *map = map_owner.get_or_null(query_parameters->get_map());
+		if (map == nullptr) {
+			query_result->reset();
+			ERR_CONTINUE(map == nullptr);
+		}
+
+		map_query_indices[map].push_back(i);
+	}
+
+	for (const KeyValue<NavMap3D *, LocalVector<uint32_t>> &E : map_query_indices) {
+		NavMeshQueries3D::map_query_paths(E.key, p_query_parameters, p_query_results, E.value);
+	}
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1518,6 +1558,15 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_PATH_CACHE_HIT_COUNT: {
+			return pm_path_cache_hit_count;
+		} break;
+		case INFO_PATH_CACHE_MISS_COUNT: {
+			return pm_path_cache_miss_count;
+		} break;
+		case INFO_PATH_CACHE_TIME_SAVED: {
+			return pm_path_cache_time_saved;
+		} break;
 	}
 
 	return 0;
@@ -40,6 +40,19 @@
 
 using namespace Nav3D;
 
+struct ClusterKey {
+	const NavBaseIteration3D *owner = nullptr;
+	PointKey cell;
+
+	static uint32_t hash(const ClusterKey &p_key) {
+		return hash_murmur3_one_64(p_key.cell.key, hash_murmur3_one_64((uint64_t)p_key.owner));
+	}
+
+	bool operator==(const ClusterKey &p_key) const {
+		return owner == p_key.owner && cell.key == p_key.cell.key;
+	}
+};
+
 PointKey NavMapBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size) {
 	const int x = static_cast<int>(Math::floor(p_pos.x / p_cell_size.x));
 	const int y = static_cast<int>(Math::floor(p_pos.y / p_cell_size.y));
@@ -72,6 +85,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_hierarchical_clusters(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -389,17 +404,136 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_hierarchical_clusters(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	map_iteration->use_hierarchical_pathfinding = r_build.use_hierarchical_pathfinding;
+	map_iteration->polygon_cluster_ids.clear();
+	map_iteration->clusters.clear();
+
+	if (!r_build.use_hierarchical_pathfinding) {
+		return;
+	}
+
+	const uint32_t polygon_count = r_build.polygon_count;
+	const Vector3 cluster_cell_size = Vector3(1.0, 1.0, 1.0) * MAX(r_build.hierarchical_cluster_size, (real_t)1.0);
+
+	LocalVector<uint32_t> &polygon_cluster_ids = map_iteration->polygon_cluster_ids;
+	LocalVector<Cluster> &clusters = map_iteration->clusters;
+	polygon_cluster_ids.resize(polygon_count);
+	for (uint32_t &cluster_id : polygon_cluster_ids) {
+		cluster_id = UINT32_MAX;
+	}
+
+	// Group region polygons per owner and cluster cell. Region polygons of different owners never share a cluster
+	// so that region filters and travel costs stay valid on the abstract graph.
+	HashMap<ClusterKey, uint32_t, ClusterKey> cluster_key_to_id;
+	LocalVector<Polygon *> cluster_polygons;
+
+	for (NavRegionIteration3D &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (Polygon &polygon : region.navmesh_polygons) {
+			Vector3 centroid;
+			for (const Vector3 &vertex : polygon.vertices) {
+				centroid += vertex;
+			}
+			centroid /= MAX(polygon.vertices.size(), 1u);
+
+			ClusterKey key;
+			key.owner = &region;
+			key.cell = get_point_key(centroid, cluster_cell_size);
+
+			HashMap<ClusterKey, uint32_t, ClusterKey>::Iterator E = cluster_key_to_id.find(key);
+			if (!E) {
+				E = cluster_key_to_id.insert(key, clusters.size());
+				Cluster cluster;
+				cluster.owner = &region;
+				clusters.push_back(cluster);
+			}
+
+			polygon_cluster_ids[polygon.id] = E->value;
+			cluster_polygons.push_back(&polygon);
+		}
+	}
+
+	// Each link polygon is a cluster on its own.
+	for (NavLinkIteration3D &link : map_iteration->link_iterations) {
+		if (!link.get_enabled()) {
+			continue;
+		}
+		for (Polygon &polygon : link.navmesh_polygons) {
+			if (polygon.id >= polygon_count) {
+				continue;
+			}
+			polygon_cluster_ids[polygon.id] = clusters.size();
+			Cluster cluster;
+			cluster.owner = &link;
+			clusters.push_back(cluster);
+			cluster_polygons.push_back(&polygon);
+		}
+	}
+
+	// Merge all connections crossing between the same two clusters into one portal at their average pathway center.
+	struct PortalAccumulator {
+		Vector3 position_sum;
+		uint32_t count = 0;
+	};
+	HashMap<uint64_t, PortalAccumulator> cluster_portals;
+
+	for (const Polygon *polygon : cluster_polygons) {
+		const uint32_t cluster_id = polygon_cluster_ids[polygon->id];
+		for (const Edge &edge : polygon->edges) {
+			for (const Edge::Connection &connection : edge.connections) {
+				if (connection.polygon->id >= polygon_count) {
+					continue;
+				}
+				const uint32_t neighbor_cluster_id = polygon_cluster_ids[connection.polygon->id];
+				if (neighbor_cluster_id == cluster_id || neighbor_cluster_id == UINT32_MAX) {
+					continue;
+				}
+				PortalAccumulator &accumulator = cluster_portals[((uint64_t)cluster_id << 32) | neighbor_cluster_id];
+				accumulator.position_sum += (connection.pathway_start + connection.pathway_end) * 0.5;
+				accumulator.count++;
+			}
+		}
+	}
+
+	for (const KeyValue<uint64_t, PortalAccumulator> &E : cluster_portals) {
+		Cluster::Portal portal;
+		portal.cluster = (uint32_t)(E.key & UINT32_MAX);
+		portal.position = E.value.position_sum / E.value.count;
+		clusters[E.key >> 32].portals.push_back(portal);
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
 	map_iteration->navmesh_polygon_count = r_build.polygon_count;
 
+	map_iteration->path_cache_rwlock.write_lock();
+	map_iteration->path_cache_size = r_build.path_cache_size;
+	map_iteration->path_cache.clear();
+	map_iteration->path_cache.reserve(r_build.path_cache_size);
+	map_iteration->path_cache_entries.clear();
+	map_iteration->path_cache_entries.resize(r_build.path_cache_size);
+	map_iteration->path_cache_clock_hand = 0;
+	map_iteration->path_cache_rwlock.write_unlock();
+
 	map_iteration->path_query_slots_mutex.lock();
 	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration->path_query_slots) {
 		p_path_query_slot.traversable_polys.clear();
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count);
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->clusters.size());
+		for (uint32_t i = 0; i < p_path_query_slot.cluster_corridor.size(); i++) {
+			p_path_query_slot.cluster_corridor[i].id = i;
+		}
 	}
 	map_iteration->path_query_slots_mutex.unlock();
 }
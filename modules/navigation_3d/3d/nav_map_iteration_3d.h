@@ -49,6 +49,9 @@ struct NavMapIterationBuild3D {
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchical_cluster_size = 64.0;
+	uint32_t path_cache_size = 0;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
 	int free_edge_count = 0;
@@ -72,6 +75,30 @@ struct NavMapIterationBuild3D {
 	}
 };
 
+struct NavPathCacheKey3D {
+	uint32_t begin_polygon_id = UINT32_MAX;
+	uint32_t end_polygon_id = UINT32_MAX;
+	uint32_t navigation_layers = 0;
+
+	static uint32_t hash(const NavPathCacheKey3D &p_key) {
+		uint32_t h = hash_murmur3_one_32(p_key.begin_polygon_id);
+		h = hash_murmur3_one_32(p_key.end_polygon_id, h);
+		return hash_fmix32(hash_murmur3_one_32(p_key.navigation_layers, h));
+	}
+
+	bool operator==(const NavPathCacheKey3D &p_key) const {
+		return begin_polygon_id == p_key.begin_polygon_id && end_polygon_id == p_key.end_polygon_id && navigation_layers == p_key.navigation_layers;
+	}
+};
+
+struct NavPathCacheEntry3D {
+	NavPathCacheKey3D key;
+	LocalVector<Nav3D::NavigationPoly> corridor;
+	bool used = false;
+	// Set on every hit, cleared by the clock hand looking for an entry to evict.
+	SafeFlag referenced;
+};
+
 struct NavMapIteration3D {
 	mutable SafeNumeric<uint32_t> users;
 	RWLock rwlock;
@@ -88,6 +115,20 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, uint32_t> region_ptr_to_region_id;
 
+	// The abstract graph used by hierarchical pathfinding, empty if it is disabled.
+	bool use_hierarchical_pathfinding = false;
+	LocalVector<uint32_t> polygon_cluster_ids;
+	LocalVector<Nav3D::Cluster> clusters;
+
+	// Path corridors found by previous queries against this iteration, ordered from the begin to the end polygon.
+	// The cache lives and dies with the iteration so it never serves corridors of an outdated map.
+	// Entries are preallocated and recycled with clock eviction once all of them are used.
+	uint32_t path_cache_size = 0;
+	mutable LocalVector<NavPathCacheEntry3D> path_cache_entries;
+	mutable HashMap<NavPathCacheKey3D, uint32_t, NavPathCacheKey3D> path_cache;
+	mutable uint32_t path_cache_clock_hand = 0;
+	mutable RWLock path_cache_rwlock;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -37,6 +37,7 @@
 #include "nav_region_iteration_3d.h"
 
 #include "core/math/geometry_3d.h"
+#include "core/os/os.h"
 #include "servers/navigation/navigation_utilities.h"
 
 using namespace Nav3D;
@@ -147,18 +148,13 @@ void NavMeshQueries3D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
+void NavMeshQueries3D::query_task_from_parameters(NavMeshPathQueryTask3D &r_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
 	using namespace NavigationUtilities;
 
-	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = r_query_task;
 	query_task.start_position = p_query_parameters->get_start_position();
 	query_task.target_position = p_query_parameters->get_target_position();
 	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -213,6 +209,16 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	query_task.simplify_path = p_query_parameters->get_simplify_path();
 	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
 	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+}
+
+void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_task_from_parameters(query_task, p_query_parameters);
+	query_task.callback = p_callback;
 
 	map->query_path(query_task);
 
@@ -231,6 +237,35 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	}
 }
 
+void NavMeshQueries3D::map_query_paths(NavMap3D *map, const TypedArray<NavigationPathQueryParameters3D> &p_query_parameters, const TypedArray<NavigationPathQueryResult3D> &p_query_results, const LocalVector<uint32_t> &p_query_indices) {
+	ERR_FAIL_NULL(map);
+
+	const uint32_t query_count = p_query_indices.size();
+	if (query_count == 0) {
+		return;
+	}
+
+	LocalVector<NavMeshPathQueryTask3D> query_tasks;
+	query_tasks.resize(query_count);
+
+	for (uint32_t i = 0; i < query_count; i++) {
+		const Ref<NavigationPathQueryParameters3D> query_parameters = p_query_parameters[p_query_indices[i]];
+		query_task_from_parameters(query_tasks[i], query_parameters);
+	}
+
+	map->query_paths(query_tasks);
+
+	for (uint32_t i = 0; i < query_count; i++) {
+		const NavMeshPathQueryTask3D &query_task = query_tasks[i];
+		Ref<NavigationPathQueryResult3D> query_result = p_query_results[p_query_indices[i]];
+		query_result->set_data(
+				query_task.path_points,
+				query_task.path_meta_point_types,
+				query_task.path_meta_point_rids,
+				query_task.path_meta_point_owners);
+	}
+}
+
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
@@ -280,7 +315,266 @@ void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask
 	}
 }
 
-void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task) {
+// Moves the corridor into the cache. The write lock is only held to swap buffers, the corridor that gets evicted is
+// freed after the lock is released.
+static void _path_cache_insert(const NavMapIteration3D &p_map_iteration, const NavPathCacheKey3D &p_key, LocalVector<NavigationPoly> &r_corridor) {
+	LocalVector<NavigationPoly> evicted_corridor;
+
+	RWLockWrite write_lock(p_map_iteration.path_cache_rwlock);
+
+	LocalVector<NavPathCacheEntry3D> &entries = p_map_iteration.path_cache_entries;
+	if (entries.is_empty()) {
+		return;
+	}
+
+	uint32_t entry_index = 0;
+	const uint32_t *existing_entry_index = p_map_iteration.path_cache.getptr(p_key);
+	if (existing_entry_index) {
+		entry_index = *existing_entry_index;
+	} else {
+		// Clock eviction, entries that were hit since the hand last passed them get a second chance.
+		while (true) {
+			entry_index = p_map_iteration.path_cache_clock_hand;
+			p_map_iteration.path_cache_clock_hand = (p_map_iteration.path_cache_clock_hand + 1) % entries.size();
+
+			NavPathCacheEntry3D &entry = entries[entry_index];
+			if (!entry.used) {
+				break;
+			}
+			if (entry.referenced.is_set()) {
+				entry.referenced.clear();
+				continue;
+			}
+			p_map_iteration.path_cache.erase(entry.key);
+			break;
+		}
+		p_map_iteration.path_cache.insert(p_key, entry_index);
+	}
+
+	NavPathCacheEntry3D &entry = entries[entry_index];
+	entry.key = p_key;
+	entry.used = true;
+	evicted_corridor = std::move(entry.corridor);
+	entry.corridor = std::move(r_corridor);
+}
+
+bool NavMeshQueries3D::_query_task_load_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const Polygon *begin_poly = p_query_task.begin_polygon;
+	const Polygon *end_poly = p_query_task.end_polygon;
+
+	NavPathCacheKey3D key;
+	key.begin_polygon_id = begin_poly->id;
+	key.end_polygon_id = end_poly->id;
+	key.navigation_layers = p_query_task.navigation_layers;
+
+	LocalVector<NavigationPoly> corridor;
+	{
+		RWLockRead read_lock(p_map_iteration.path_cache_rwlock);
+		const uint32_t *entry_index = p_map_iteration.path_cache.getptr(key);
+		if (entry_index) {
+			NavPathCacheEntry3D &entry = p_map_iteration.path_cache_entries[*entry_index];
+			entry.referenced.set();
+			corridor = entry.corridor;
+		} else {
+			// The target may have moved just one polygon away from where a previous query ended.
+			NavPathCacheKey3D neighbor_key = key;
+			for (const Edge &edge : end_poly->edges) {
+				for (const Edge::Connection &connection : edge.connections) {
+					neighbor_key.end_polygon_id = connection.polygon->id;
+					entry_index = p_map_iteration.path_cache.getptr(neighbor_key);
+					if (entry_index) {
+						NavPathCacheEntry3D &entry = p_map_iteration.path_cache_entries[*entry_index];
+						entry.referenced.set();
+						corridor = entry.corridor;
+						break;
+					}
+				}
+				if (!corridor.is_empty()) {
+					break;
+				}
+			}
+		}
+	}
+
+	if (corridor.is_empty()) {
+		return false;
+	}
+
+	if (corridor[corridor.size() - 1].poly != end_poly) {
+		// Incremental replanning, repair the neighbor corridor instead of searching again.
+		int64_t end_poly_index = -1;
+		for (uint32_t i = 0; i < corridor.size(); i++) {
+			if (corridor[i].poly == end_poly) {
+				end_poly_index = i;
+				break;
+			}
+		}
+
+		if (end_poly_index != -1) {
+			// The target moved back along the corridor, cut it at the new end polygon.
+			corridor.resize(end_poly_index + 1);
+		} else {
+			// The target moved forward into a neighbor polygon, extend the corridor by one step.
+			if (!_query_task_is_connection_owner_usable(p_query_task, end_poly->owner)) {
+				return false;
+			}
+
+			const NavigationPoly &last_navigation_poly = corridor[corridor.size() - 1];
+			const Edge::Connection *end_connection = nullptr;
+			for (const Edge &edge : last_navigation_poly.poly->edges) {
+				for (const Edge::Connection &connection : edge.connections) {
+					if (connection.polygon == end_poly) {
+						end_connection = &connection;
+						break;
+					}
+				}
+				if (end_connection) {
+					break;
+				}
+			}
+
+			if (!end_connection) {
+				// One-way connection, e.g. a link that can only be traveled in the other direction.
+				return false;
+			}
+
+			NavigationPoly end_navigation_poly;
+			end_navigation_poly.poly = end_poly;
+			end_navigation_poly.back_navigation_poly_id = last_navigation_poly.poly->id;
+			end_navigation_poly.back_navigation_edge = end_connection->edge;
+			end_navigation_poly.back_navigation_edge_pathway_start = end_connection->pathway_start;
+			end_navigation_poly.back_navigation_edge_pathway_end = end_connection->pathway_end;
+			end_navigation_poly.entry = Geometry3D::get_closest_point_to_segment(last_navigation_poly.entry, end_connection->pathway_start, end_connection->pathway_end);
+			corridor.push_back(end_navigation_poly);
+		}
+
+		// Repaired corridors are not cached. Only corridors from a full search are repaired, so a moving target
+		// can't chain repairs into a corridor that keeps growing away from the shortest route.
+	}
+
+	// The begin polygon follows the current start position, the post-processing only walks the corridor backwards
+	// from the end polygon so the other polygons of the slot do not need to be reset.
+	NavigationPoly &begin_navigation_poly = corridor[0];
+	begin_navigation_poly.entry = p_query_task.begin_position;
+	begin_navigation_poly.back_navigation_edge_pathway_start = p_query_task.begin_position;
+	begin_navigation_poly.back_navigation_edge_pathway_end = p_query_task.begin_position;
+
+	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+	for (const NavigationPoly &navigation_poly : corridor) {
+		navigation_polys[navigation_poly.poly->id] = navigation_poly;
+	}
+	p_query_task.least_cost_id = end_poly->id;
+
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_store_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	LocalVector<NavigationPoly> corridor;
+	int navigation_poly_id = p_query_task.least_cost_id;
+	while (navigation_poly_id != -1) {
+		corridor.push_back(navigation_polys[navigation_poly_id]);
+		navigation_poly_id = navigation_polys[navigation_poly_id].back_navigation_poly_id;
+	}
+	corridor.reverse();
+
+	NavPathCacheKey3D key;
+	key.begin_polygon_id = p_query_task.begin_polygon->id;
+	key.end_polygon_id = p_query_task.end_polygon->id;
+	key.navigation_layers = p_query_task.navigation_layers;
+
+	_path_cache_insert(p_map_iteration, key, corridor);
+}
+
+void NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	p_query_task.use_cluster_corridor = false;
+
+	const LocalVector<uint32_t> &polygon_cluster_ids = p_map_iteration.polygon_cluster_ids;
+	const LocalVector<Cluster> &clusters = p_map_iteration.clusters;
+
+	const uint32_t begin_cluster_id = polygon_cluster_ids[p_query_task.begin_polygon->id];
+	const uint32_t end_cluster_id = polygon_cluster_ids[p_query_task.end_polygon->id];
+	if (begin_cluster_id == UINT32_MAX || end_cluster_id == UINT32_MAX || begin_cluster_id == end_cluster_id) {
+		// Short queries gain nothing from the abstract graph.
+		return;
+	}
+
+	const Vector3 end_point = p_query_task.end_position;
+
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>
+			&traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	for (NavigationCluster &cluster : navigation_clusters) {
+		cluster.reset();
+	}
+
+	NavigationCluster &begin_navigation_cluster = navigation_clusters[begin_cluster_id];
+	begin_navigation_cluster.entry = p_query_task.begin_position;
+	begin_navigation_cluster.traveled_distance = 0.0;
+	traversable_clusters.push(&begin_navigation_cluster);
+
+	// A* over the abstract graph, using the same cost model as the polygon search with portals as entry points.
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const NavigationCluster *least_cost_cluster = traversable_clusters.pop();
+		if (least_cost_cluster->id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		const Cluster &cluster = clusters[least_cost_cluster->id];
+		const real_t cluster_travel_cost = cluster.owner->get_travel_cost();
+
+		for (const Cluster::Portal &portal : cluster.portals) {
+			const NavBaseIteration3D *neighbor_owner = clusters[portal.cluster].owner;
+			if (!_query_task_is_connection_owner_usable(p_query_task, neighbor_owner)) {
+				continue;
+			}
+
+			real_t new_traveled_distance = least_cost_cluster->entry.distance_to(portal.position) * cluster_travel_cost + least_cost_cluster->traveled_distance;
+			if (neighbor_owner != cluster.owner) {
+				new_traveled_distance += neighbor_owner->get_enter_cost();
+			}
+
+			NavigationCluster &neighbor_cluster = navigation_clusters[portal.cluster];
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_cluster_id = least_cost_cluster->id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+				neighbor_cluster.distance_to_destination = portal.position.distance_to(end_point) * neighbor_owner->get_travel_cost();
+				neighbor_cluster.entry = portal.position;
+
+				if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+	}
+
+	if (!found_route) {
+		// Let the full search deal with unreachable targets.
+		return;
+	}
+
+	// Restrict the refined search to the clusters on the abstract path and their direct neighbors. The extra ring gives
+	// the polygon search room to cut corners the single point portals would otherwise force.
+	uint32_t cluster_id = end_cluster_id;
+	while (cluster_id != UINT32_MAX) {
+		navigation_clusters[cluster_id].in_corridor = true;
+		for (const Cluster::Portal &portal : clusters[cluster_id].portals) {
+			navigation_clusters[portal.cluster].in_corridor = true;
+		}
+		cluster_id = navigation_clusters[cluster_id].back_cluster_id;
+	}
+
+	p_query_task.use_cluster_corridor = true;
+}
+
+void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
 	const Polygon *end_poly = p_query_task.end_polygon;
@@ -305,6 +599,11 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
 	begin_navigation_poly.traveled_distance = 0.f;
 
+	// When a cluster corridor was found the search only expands polygons inside of it.
+	bool use_cluster_corridor = p_query_task.use_cluster_corridor;
+	const LocalVector<uint32_t> &polygon_cluster_ids = p_map_iteration.polygon_cluster_ids;
+	const LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+
 	// This is an implementation of the A* algorithm.
 	uint32_t least_cost_id = begin_poly->id;
 	bool found_route = false;
@@ -330,6 +629,13 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 					continue;
 				}
 
+				if (use_cluster_corridor) {
+					const uint32_t connection_cluster_id = polygon_cluster_ids[connection.polygon->id];
+					if (connection_cluster_id == UINT32_MAX || !navigation_clusters[connection_cluster_id].in_corridor) {
+						continue;
+					}
+				}
+
 				const Vector3 new_entry = Geometry3D::get_closest_point_to_segment(least_cost_poly.entry, connection.pathway_start, connection.pathway_end);
 				const real_t new_traveled_distance = least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + poly_enter_cost + least_cost_poly.traveled_distance;
 
@@ -358,6 +664,23 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		}
 
 		poly_enter_cost = 0;
+		if (traversable_polys.is_empty() && use_cluster_corridor) {
+			// The corridor did not contain a polygon route, search the whole map instead.
+			use_cluster_corridor = false;
+			for (NavigationPoly &polygon : navigation_polys) {
+				polygon.reset();
+			}
+			navigation_polys[begin_poly->id].poly = begin_poly;
+			navigation_polys[begin_poly->id].entry = begin_point;
+			navigation_polys[begin_poly->id].back_navigation_edge_pathway_start = begin_point;
+			navigation_polys[begin_poly->id].back_navigation_edge_pathway_end = begin_point;
+			navigation_polys[begin_poly->id].traveled_distance = 0.f;
+			least_cost_id = begin_poly->id;
+			reachable_end = nullptr;
+			distance_to_reachable_end = FLT_MAX;
+			continue;
+		}
+
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
@@ -485,12 +808,39 @@ void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task);
+	// Corridors only depend on the polygons and layers as long as no region filter is used. Queries without
+	// post-processing return the raw entry points which depend on the start position, so they are not cached.
+	const bool use_path_cache = p_map_iteration.path_cache_size > 0 &&
+			!p_query_task.exclude_regions &&
+			!p_query_task.include_regions &&
+			p_query_task.path_postprocessing != PathPostProcessing::PATH_POSTPROCESSING_NONE;
 
-	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
-		return;
+	const uint64_t path_search_start_usec = OS::get_singleton()->get_ticks_usec();
+
+	p_query_task.path_cache_hit = use_path_cache && _query_task_load_cached_path_corridor(p_query_task, p_map_iteration);
+
+	if (!p_query_task.path_cache_hit) {
+		const Polygon *requested_end_polygon = p_query_task.end_polygon;
+
+		if (p_map_iteration.use_hierarchical_pathfinding) {
+			_query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+		}
+
+		_query_task_build_path_corridor(p_query_task, p_map_iteration);
+
+		if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
+			p_query_task.path_search_usec = OS::get_singleton()->get_ticks_usec() - path_search_start_usec;
+			return;
+		}
+
+		// Only corridors that reached the requested end polygon are reusable.
+		if (use_path_cache && p_query_task.end_polygon == requested_end_polygon) {
+			_query_task_store_cached_path_corridor(p_query_task, p_map_iteration);
+		}
 	}
 
+	p_query_task.path_search_usec = OS::get_singleton()->get_ticks_usec() - path_search_start_usec;
+
 	// Post-Process path.
 	switch (p_query_task.path_postprocessing) {
 		case PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
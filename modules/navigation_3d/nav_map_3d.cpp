@@ -172,6 +172,7 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 	p_query_task.map_up = map_iteration.map_up;
 
 	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	_record_path_query(p_query_task);
 
 	map_iteration.path_query_slots_mutex.lock();
 	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
@@ -182,6 +183,107 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 	map_iteration.path_query_slots_semaphore.post();
 }
 
+void NavMap3D::query_paths(LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &p_query_tasks) {
+	if (iteration_id == 0 || p_query_tasks.is_empty()) {
+		return;
+	}
+
+	// All queries of the batch run against the same iteration snapshot, the read lock is held until every worker is done.
+	GET_MAP_ITERATION();
+
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_tasks = p_query_tasks.ptr();
+	batch.query_count = p_query_tasks.size();
+
+	// Each worker holds one path query slot for its whole run and pulls queries from the shared counter.
+	uint32_t worker_count = MIN((uint32_t)path_query_slots_max, batch.query_count);
+
+	if (use_threads && worker_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_query_paths_batch_worker, &batch, worker_count, worker_count, true, SNAME("NavMapQueryPaths3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_query_paths_batch_worker(0, &batch);
+	}
+}
+
+void NavMap3D::_query_paths_batch_worker(uint32_t p_worker_index, PathQueryBatch *p_batch) {
+	NavMapIteration3D &map_iteration = *p_batch->map_iteration;
+
+	map_iteration.path_query_slots_semaphore.wait();
+
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
+	map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+		if (!p_path_query_slot.in_use) {
+			p_path_query_slot.in_use = true;
+			path_query_slot = &p_path_query_slot;
+			break;
+		}
+	}
+	map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_MSG(path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+	}
+
+	uint32_t query_index = p_batch->next_query_index.postincrement();
+	while (query_index < p_batch->query_count) {
+		NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = p_batch->query_tasks[query_index];
+		query_task.path_query_slot = path_query_slot;
+		query_task.map_up = map_iteration.map_up;
+
+		NavMeshQueries3D::query_task_map_iteration_get_path(query_task, map_iteration);
+		_record_path_query(query_task);
+
+		query_task.path_query_slot = nullptr;
+		query_index = p_batch->next_query_index.postincrement();
+	}
+
+	map_iteration.path_query_slots_mutex.lock();
+	path_query_slot->in_use = false;
+	map_iteration.path_query_slots_mutex.unlock();
+
+	map_iteration.path_query_slots_semaphore.post();
+}
+
+void NavMap3D::_record_path_query(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
+	if (path_cache_size == 0) {
+		return;
+	}
+	if (p_query_task.path_cache_hit) {
+		path_cache_hit_count.increment();
+		path_cache_hit_usec.add(p_query_task.path_search_usec);
+	} else {
+		path_cache_miss_count.increment();
+		path_cache_miss_usec.add(p_query_task.path_search_usec);
+	}
+}
+
+void NavMap3D::_sync_path_cache_statistics() {
+	// Only subtract what was read so queries running on other threads meanwhile are counted in the next sync.
+	const uint64_t hit_count = path_cache_hit_count.get();
+	const uint64_t miss_count = path_cache_miss_count.get();
+	const uint64_t hit_usec = path_cache_hit_usec.get();
+	const uint64_t miss_usec = path_cache_miss_usec.get();
+	path_cache_hit_count.sub(hit_count);
+	path_cache_miss_count.sub(miss_count);
+	path_cache_hit_usec.sub(hit_usec);
+	path_cache_miss_usec.sub(miss_usec);
+
+	if (miss_count > 0) {
+		path_search_average_usec = miss_usec / miss_count;
+	}
+
+	// The time saved is estimated from what the cache hits would have cost as regular searches.
+	const uint64_t estimated_search_usec = hit_count * path_search_average_usec;
+
+	performance_data.pm_path_cache_hit_count = hit_count;
+	performance_data.pm_path_cache_miss_count = miss_count;
+	performance_data.pm_path_cache_time_saved = estimated_search_usec > hit_usec ? estimated_search_usec - hit_usec : 0;
+}
+
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	if (iteration_id == 0) {
 		NAVMAP_ITERATION_ZERO_ERROR_MSG();
@@ -366,6 +468,9 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.use_hierarchical_pathfinding = use_hierarchical_pathfinding;
+	iteration_build.hierarchical_cluster_size = hierarchical_cluster_size;
+	iteration_build.path_cache_size = path_cache_size;
 
 	uint32_t enabled_region_count = 0;
 	uint32_t enabled_link_count = 0;
@@ -460,6 +565,7 @@ void NavMap3D::sync() {
 	performance_data.pm_agent_count = agents.size();
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
+	_sync_path_cache_statistics();
 
 	_sync_dirty_map_update_requests();
 
@@ -850,6 +956,10 @@ NavMap3D::NavMap3D() {
 		path_query_slots_max = 1;
 	}
 
+	use_hierarchical_pathfinding = GLOBAL_GET("navigation/pathfinding/use_hierarchical_pathfinding");
+	hierarchical_cluster_size = GLOBAL_GET("navigation/pathfinding/hierarchical_cluster_size");
+	path_cache_size = MAX(0, (int)GLOBAL_GET("navigation/pathfinding/path_cache_size"));
+
 	iteration_slots.resize(2);
 
 	for (NavMapIteration3D &iteration_slot : iteration_slots) {
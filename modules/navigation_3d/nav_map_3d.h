@@ -120,6 +120,17 @@ class NavMap3D : public NavRid3D {
 
 	int path_query_slots_max = 4;
 
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchical_cluster_size = 64.0;
+
+	uint32_t path_cache_size = 0;
+	// Path query statistics since the last sync, see `_sync_path_cache_statistics()`.
+	SafeNumeric<uint64_t> path_cache_hit_count;
+	SafeNumeric<uint64_t> path_cache_miss_count;
+	SafeNumeric<uint64_t> path_cache_hit_usec;
+	SafeNumeric<uint64_t> path_cache_miss_usec;
+	uint64_t path_search_average_usec = 0;
+
 	bool use_async_iterations = true;
 
 	uint32_t iteration_slot_index = 0;
@@ -181,6 +192,7 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void query_paths(LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &p_query_tasks);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -233,6 +245,9 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	int get_pm_path_cache_hit_count() const { return performance_data.pm_path_cache_hit_count; }
+	int get_pm_path_cache_miss_count() const { return performance_data.pm_path_cache_miss_count; }
+	int get_pm_path_cache_time_saved() const { return performance_data.pm_path_cache_time_saved; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -260,6 +275,16 @@ private:
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
 
+	struct PathQueryBatch {
+		NavMapIteration3D *map_iteration = nullptr;
+		NavMeshQueries3D::NavMeshPathQueryTask3D *query_tasks = nullptr;
+		uint32_t query_count = 0;
+		SafeNumeric<uint32_t> next_query_index;
+	};
+	void _query_paths_batch_worker(uint32_t p_worker_index, PathQueryBatch *p_batch);
+	void _record_path_query(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void _sync_path_cache_statistics();
+
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
@@ -174,6 +174,77 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+/// A group of polygons of the same owner used by hierarchical pathfinding.
+struct Cluster {
+	/// Connection from this cluster to a neighbor cluster.
+	struct Portal {
+		/// Id of the cluster this portal leads to.
+		uint32_t cluster = UINT32_MAX;
+
+		/// Representative crossing point, the average of all pathways between both clusters.
+		Vector3 position;
+	};
+
+	/// Navigation region or link that contains the polygons of this cluster.
+	const NavBaseIteration3D *owner = nullptr;
+
+	LocalVector<Portal> portals;
+};
+
+struct NavigationCluster {
+	/// Id of this cluster in the map.
+	uint32_t id = UINT32_MAX;
+
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// Previous cluster on the abstract path.
+	uint32_t back_cluster_id = UINT32_MAX;
+
+	/// Whether the polygons of this cluster may be used by the refined search.
+	bool in_corridor = false;
+
+	/// The entry position of this cluster.
+	Vector3 entry;
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = 0.0;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_cluster_id = UINT32_MAX;
+		in_corridor = false;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->distance_to_destination > p_cluster_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -195,6 +266,9 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
+	int pm_path_cache_time_saved = 0;
 
 	void reset() {
 		pm_region_count = 0;
@@ -206,6 +280,9 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_path_cache_hit_count = 0;
+		pm_path_cache_miss_count = 0;
+		pm_path_cache_time_saved = 0;
 	}
 };
 
@@ -0,0 +1,282 @@
+/**************************************************************************/
+/*  test_nav_mesh_queries_3d.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+
+#pragma once
+
+#include "../3d/nav_map_builder_3d.h"
+#include "../3d/nav_map_iteration_3d.h"
+#include "../3d/nav_mesh_queries_3d.h"
+#include "../3d/nav_region_iteration_3d.h"
+#include "../nav_link_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNavMeshQueries3D {
+
+// Fills the map iteration with a single region made of a grid of one by one meter quads and builds it.
+static void build_grid_map_iteration(NavMapIteration3D &r_map_iteration, NavMapIterationBuild3D &r_build, int p_size_x, int p_size_z) {
+	r_map_iteration.region_iterations.clear();
+	r_map_iteration.region_iterations.resize(1);
+	NavRegionIteration3D &region = r_map_iteration.region_iterations[0];
+	region.id = 0;
+	region.owner_type = NavigationUtilities::PathSegmentType::PATH_SEGMENT_TYPE_REGION;
+	region.bounds = AABB(Vector3(), Vector3(p_size_x, 0, p_size_z));
+
+	region.navmesh_polygons.resize(p_size_x * p_size_z);
+	for (int z = 0; z < p_size_z; z++) {
+		for (int x = 0; x < p_size_x; x++) {
+			Nav3D::Polygon &polygon = region.navmesh_polygons[z * p_size_x + x];
+			polygon.owner = &region;
+			polygon.vertices.push_back(Vector3(x, 0, z));
+			polygon.vertices.push_back(Vector3(x + 1, 0, z));
+			polygon.vertices.push_back(Vector3(x + 1, 0, z + 1));
+			polygon.vertices.push_back(Vector3(x, 0, z + 1));
+			polygon.edges.resize(4);
+		}
+	}
+
+	r_map_iteration.map_up = Vector3(0, 1, 0);
+	if (r_map_iteration.path_query_slots.is_empty()) {
+		r_map_iteration.path_query_slots.resize(1);
+	}
+
+	r_build.reset();
+	r_build.map_iteration = &r_map_iteration;
+	r_build.merge_rasterizer_cell_size = Vector3(0.05, 0.05, 0.05);
+	r_build.use_edge_connections = false;
+	r_build.edge_connection_margin = 0.25;
+	r_build.link_connection_radius = 1.0;
+	NavMapBuilder3D::build_navmap_iteration(r_build);
+}
+
+static void query_path(NavMapIteration3D &p_map_iteration, const Vector3 &p_from, const Vector3 &p_to, NavMeshQueries3D::NavMeshPathQueryTask3D &r_query_task) {
+	r_query_task.start_position = p_from;
+	r_query_task.target_position = p_to;
+	r_query_task.navigation_layers = 1;
+	r_query_task.map_up = p_map_iteration.map_up;
+	r_query_task.path_query_slot = &p_map_iteration.path_query_slots[0];
+	NavMeshQueries3D::query_task_map_iteration_get_path(r_query_task, p_map_iteration);
+}
+
+static real_t get_path_length(const LocalVector<Vector3> &p_path) {
+	real_t length = 0.0;
+	for (uint32_t i = 1; i < p_path.size(); i++) {
+		length += p_path[i - 1].distance_to(p_path[i]);
+	}
+	return length;
+}
+
+TEST_CASE("[Navigation3D] Hierarchical pathfinding restricts long queries to a cluster corridor") {
+	NavMapIteration3D map_iteration;
+	NavMapIterationBuild3D build;
+	build.use_hierarchical_pathfinding = true;
+	build.hierarchical_cluster_size = 4.0;
+	build_grid_map_iteration(map_iteration, build, 32, 16);
+
+	// 8 by 4 clusters of 4 by 4 polygons.
+	REQUIRE_EQ(map_iteration.clusters.size(), 32u);
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(31.5, 0, 0.5), query_task);
+
+	CHECK(query_task.use_cluster_corridor);
+
+	// The abstract path runs along the first row of clusters, the corridor only adds their direct neighbors.
+	const LocalVector<Nav3D::NavigationCluster> &cluster_corridor = map_iteration.path_query_slots[0].cluster_corridor;
+	const uint32_t far_polygon_id = 14 * 32 + 16;
+	CHECK(cluster_corridor[map_iteration.polygon_cluster_ids[0]].in_corridor);
+	CHECK(cluster_corridor[map_iteration.polygon_cluster_ids[4 * 32 + 16]].in_corridor);
+	CHECK_FALSE(cluster_corridor[map_iteration.polygon_cluster_ids[far_polygon_id]].in_corridor);
+	CHECK_EQ(map_iteration.path_query_slots[0].path_corridor[far_polygon_id].traveled_distance, FLT_MAX);
+
+	// The path is valid, a straight line along the first row of polygons.
+	REQUIRE_EQ(query_task.path_points.size(), 2u);
+	CHECK(query_task.path_points[0].is_equal_approx(Vector3(0.5, 0, 0.5)));
+	CHECK(query_task.path_points[1].is_equal_approx(Vector3(31.5, 0, 0.5)));
+}
+
+TEST_CASE("[Navigation3D] Hierarchical pathfinding finds the same route as the regular search") {
+	NavMapIteration3D map_iteration;
+	NavMapIterationBuild3D build;
+	build_grid_map_iteration(map_iteration, build, 32, 16);
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_path(map_iteration, Vector3(0.5, 0, 15.5), Vector3(31.5, 0, 0.5), query_task);
+	CHECK_FALSE(query_task.use_cluster_corridor);
+
+	NavMapIteration3D hierarchical_map_iteration;
+	NavMapIterationBuild3D hierarchical_build;
+	hierarchical_build.use_hierarchical_pathfinding = true;
+	hierarchical_build.hierarchical_cluster_size = 4.0;
+	build_grid_map_iteration(hierarchical_map_iteration, hierarchical_build, 32, 16);
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D hierarchical_query_task;
+	query_path(hierarchical_map_iteration, Vector3(0.5, 0, 15.5), Vector3(31.5, 0, 0.5), hierarchical_query_task);
+	CHECK(hierarchical_query_task.use_cluster_corridor);
+
+	REQUIRE_GE(query_task.path_points.size(), 2u);
+	REQUIRE_GE(hierarchical_query_task.path_points.size(), 2u);
+	CHECK(query_task.path_points[0].is_equal_approx(hierarchical_query_task.path_points[0]));
+	CHECK(query_task.path_points[query_task.path_points.size() - 1].is_equal_approx(hierarchical_query_task.path_points[hierarchical_query_task.path_points.size() - 1]));
+
+	// On an open grid the corridor leaves enough room for a route as short as the regular one.
+	CHECK_LE(get_path_length(hierarchical_query_task.path_points), get_path_length(query_task.path_points) * 1.05);
+}
+
+TEST_CASE("[Navigation3D] Path cache reuses and repairs corridors of previous queries") {
+	NavMapIteration3D map_iteration;
+	NavMapIterationBuild3D build;
+	build.path_cache_size = 4;
+	build_grid_map_iteration(map_iteration, build, 16, 1);
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(14.5, 0, 0.5), query_task);
+	CHECK_FALSE(query_task.path_cache_hit);
+	CHECK_EQ(map_iteration.path_cache.size(), 1u);
+
+	SUBCASE("Same begin and end polygon should reuse the cached corridor") {
+		NavMeshQueries3D::NavMeshPathQueryTask3D cached_query_task;
+		query_path(map_iteration, Vector3(0.25, 0, 0.5), Vector3(14.75, 0, 0.5), cached_query_task);
+		CHECK(cached_query_task.path_cache_hit);
+		REQUIRE_EQ(cached_query_task.path_points.size(), 2u);
+		CHECK(cached_query_task.path_points[0].is_equal_approx(Vector3(0.25, 0, 0.5)));
+		CHECK(cached_query_task.path_points[1].is_equal_approx(Vector3(14.75, 0, 0.5)));
+	}
+
+	SUBCASE("Target moving back along the corridor should cut the cached corridor") {
+		NavMeshQueries3D::NavMeshPathQueryTask3D cut_query_task;
+		query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(13.5, 0, 0.5), cut_query_task);
+		CHECK(cut_query_task.path_cache_hit);
+		CHECK_MESSAGE(map_iteration.path_cache.size() == 1u, "Repaired corridors should not be cached.");
+		REQUIRE_EQ(cut_query_task.path_points.size(), 2u);
+		CHECK(cut_query_task.path_points[1].is_equal_approx(Vector3(13.5, 0, 0.5)));
+	}
+
+	SUBCASE("Target moving into a connected neighbor polygon should extend the cached corridor") {
+		NavMeshQueries3D::NavMeshPathQueryTask3D extended_query_task;
+		query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(15.5, 0, 0.5), extended_query_task);
+		CHECK(extended_query_task.path_cache_hit);
+		CHECK_MESSAGE(map_iteration.path_cache.size() == 1u, "Repaired corridors should not be cached.");
+		REQUIRE_EQ(extended_query_task.path_points.size(), 2u);
+		CHECK(extended_query_task.path_points[1].is_equal_approx(Vector3(15.5, 0, 0.5)));
+	}
+
+	SUBCASE("Target moving over a one-way connection should not extend the cached corridor") {
+		// Only keep the connection from polygon 15 back to polygon 14.
+		Nav3D::Polygon &last_corridor_polygon = map_iteration.region_iterations[0].navmesh_polygons[14];
+		for (Nav3D::Edge &edge : last_corridor_polygon.edges) {
+			for (int64_t i = edge.connections.size() - 1; i >= 0; i--) {
+				if (edge.connections[i].polygon->id == 15) {
+					edge.connections.remove_at(i);
+				}
+			}
+		}
+
+		NavMeshQueries3D::NavMeshPathQueryTask3D one_way_query_task;
+		query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(15.5, 0, 0.5), one_way_query_task);
+		CHECK_FALSE(one_way_query_task.path_cache_hit);
+		REQUIRE_GE(one_way_query_task.path_points.size(), 2u);
+		CHECK_FALSE(one_way_query_task.path_points[one_way_query_task.path_points.size() - 1].is_equal_approx(Vector3(15.5, 0, 0.5)));
+	}
+
+	SUBCASE("Rebuilding the map should invalidate the cached corridors") {
+		build_grid_map_iteration(map_iteration, build, 16, 1);
+		CHECK_EQ(map_iteration.path_cache.size(), 0u);
+
+		NavMeshQueries3D::NavMeshPathQueryTask3D rebuilt_query_task;
+		query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(14.5, 0, 0.5), rebuilt_query_task);
+		CHECK_FALSE(rebuilt_query_task.path_cache_hit);
+	}
+
+	SUBCASE("A full cache should evict the entries that were not hit since the last sweep") {
+		for (int x = 1; x < 4; x++) {
+			query_path(map_iteration, Vector3(x + 0.5, 0, 0.5), Vector3(14.5, 0, 0.5), query_task);
+		}
+		CHECK_EQ(map_iteration.path_cache.size(), 4u);
+
+		// Hit the first corridor again so it gets a second chance.
+		query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(14.5, 0, 0.5), query_task);
+		CHECK(query_task.path_cache_hit);
+
+		query_path(map_iteration, Vector3(4.5, 0, 0.5), Vector3(14.5, 0, 0.5), query_task);
+		CHECK_FALSE(query_task.path_cache_hit);
+		CHECK_EQ(map_iteration.path_cache.size(), 4u);
+
+		query_path(map_iteration, Vector3(0.5, 0, 0.5), Vector3(14.5, 0, 0.5), query_task);
+		CHECK(query_task.path_cache_hit);
+		query_path(map_iteration, Vector3(1.5, 0, 0.5), Vector3(14.5, 0, 0.5), query_task);
+		CHECK_FALSE(query_task.path_cache_hit);
+	}
+}
+
+TEST_CASE("[Navigation3D] Path cache repairs stay close to a fresh search for a moving target") {
+	NavMapIteration3D map_iteration;
+	NavMapIterationBuild3D build;
+	build.path_cache_size = 16;
+	build_grid_map_iteration(map_iteration, build, 16, 16);
+
+	NavMapIteration3D fresh_map_iteration;
+	NavMapIterationBuild3D fresh_build;
+	build_grid_map_iteration(fresh_map_iteration, fresh_build, 16, 16);
+
+	// The target walks away from the start and then back towards it along another side, which is
+	// where chained repairs would drag the corridor along the whole route.
+	LocalVector<Vector3> route;
+	for (int z = 0; z < 16; z++) {
+		route.push_back(Vector3(15.5, 0, z + 0.5));
+	}
+	for (int x = 14; x >= 0; x--) {
+		route.push_back(Vector3(x + 0.5, 0, 15.5));
+	}
+
+	const Vector3 start_position = Vector3(0.5, 0, 0.5);
+	int cache_hit_count = 0;
+	for (const Vector3 &target_position : route) {
+		NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+		query_path(map_iteration, start_position, target_position, query_task);
+		cache_hit_count += query_task.path_cache_hit ? 1 : 0;
+
+		NavMeshQueries3D::NavMeshPathQueryTask3D fresh_query_task;
+		query_path(fresh_map_iteration, start_position, target_position, fresh_query_task);
+		CHECK_FALSE(fresh_query_task.path_cache_hit);
+
+		REQUIRE_GE(query_task.path_points.size(), 2u);
+		REQUIRE_GE(fresh_query_task.path_points.size(), 2u);
+		CHECK(query_task.path_points[query_task.path_points.size() - 1].is_equal_approx(target_position));
+		// A single repair step can add at most a detour through one extra polygon.
+		CHECK_LE(get_path_length(query_task.path_points), get_path_length(fresh_query_task.path_points) + 2.0);
+	}
+
+	// Every other step is repaired from the corridor of the previous full search.
+	CHECK_GE(cache_hit_count, int(route.size() / 2) - 1);
+}
+
+} // namespace TestNavMeshQueries3D
@@ -41,6 +41,10 @@ int AudioStreamPlaybackOggVorbis::_mix_internal(AudioFrame *p_buffer, int p_fram
 		return 0;
 	}
 
+	if (seek_pending) {
+		seek(double(frames_mixed) / vorbis_data->get_sampling_rate());
+	}
+
 	int todo = p_frames;
 
 	int beat_length_frames = -1;
@@ -188,6 +192,52 @@ int AudioStreamPlaybackOggVorbis::_mix_frames_vorbis(AudioFrame *p_buffer, int p
 	return frames;
 }
 
+int AudioStreamPlaybackOggVorbis::_skip_internal(int p_frames) {
+	ERR_FAIL_COND_V(!ready, 0);
+
+	if (!active) {
+		return 0;
+	}
+
+	int64_t sampling_rate = vorbis_data->get_sampling_rate();
+	int64_t end_frame = vorbis_stream->get_length() * sampling_rate;
+	if (end_frame <= 0) {
+		return AudioStreamPlaybackResampled::_skip_internal(p_frames);
+	}
+
+	bool use_loop = looping_override ? looping : vorbis_stream->loop;
+	if (use_loop && vorbis_stream->get_bpm() > 0 && vorbis_stream->get_beat_count() > 0) {
+		end_frame = MIN(end_frame, int64_t(vorbis_stream->get_beat_count() * sampling_rate * 60 / vorbis_stream->get_bpm()));
+	}
+
+	// Only move the position, the seek happens once the stream is mixed again.
+	int64_t position = int64_t(frames_mixed) + p_frames;
+	seek_pending = true;
+	loop_fade_remaining = FADE_SIZE;
+
+	if (position < end_frame) {
+		frames_mixed = position;
+		return p_frames;
+	}
+
+	if (!use_loop) {
+		int skipped = MAX(end_frame - int64_t(frames_mixed), int64_t(0));
+		frames_mixed = end_frame;
+		active = false;
+		return skipped;
+	}
+
+	int64_t loop_begin = vorbis_stream->loop_offset * sampling_rate;
+	if (loop_begin >= end_frame) {
+		loop_begin = 0;
+	}
+	int64_t loop_length = end_frame - loop_begin;
+	int64_t overflow = position - end_frame;
+	loops += 1 + overflow / loop_length;
+	frames_mixed = loop_begin + overflow % loop_length;
+	return p_frames;
+}
+
 float AudioStreamPlaybackOggVorbis::get_stream_sampling_rate() {
 	return vorbis_data->get_sampling_rate();
 }
@@ -282,6 +332,8 @@ void AudioStreamPlaybackOggVorbis::seek(double p_time) {
 		return;
 	}
 
+	seek_pending = false;
+
 	if (p_time >= vorbis_stream->get_length()) {
 		p_time = 0;
 	}
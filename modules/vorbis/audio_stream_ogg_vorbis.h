@@ -46,6 +46,7 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 
 	uint32_t frames_mixed = 0;
 	bool active = false;
+	bool seek_pending = false; // Skipped ahead without decoding, seek to `frames_mixed` before the next mix.
 	bool looping_override = false;
 	bool looping = false;
 	int loops = 0;
@@ -88,6 +89,7 @@ class AudioStreamPlaybackOggVorbis : public AudioStreamPlaybackResampled {
 
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
+	virtual int _skip_internal(int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
 public:
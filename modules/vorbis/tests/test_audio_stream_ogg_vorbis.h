@@ -0,0 +1,128 @@
+/**************************************************************************/
+/*  test_audio_stream_ogg_vorbis.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../audio_stream_ogg_vorbis.h"
+
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioStreamOggVorbis {
+
+constexpr int BLOCK_SIZE = 512;
+
+// One second of a 440 Hz sine wave, encoded at 22050 Hz so mixing has to resample it.
+Ref<AudioStreamOggVorbis> load_test_stream() {
+	Ref<AudioStreamOggVorbis> stream = AudioStreamOggVorbis::load_from_file(String("modules/vorbis/tests/data/").path_join("sine_440hz_22050hz_mono.ogg"));
+	REQUIRE(stream.is_valid());
+	REQUIRE(stream->get_length() == doctest::Approx(1.0).epsilon(0.01));
+	return stream;
+}
+
+int get_block_count_for_length(const Ref<AudioStreamOggVorbis> &p_stream, double p_factor) {
+	return Math::ceil(p_stream->get_length() * AudioServer::get_singleton()->get_mix_rate() * p_factor / BLOCK_SIZE);
+}
+
+TEST_CASE("[Audio][AudioStreamOggVorbis] Skipping matches mixing") {
+	Ref<AudioStreamOggVorbis> stream = load_test_stream();
+
+	Ref<AudioStreamPlayback> mixed_playback = stream->instantiate_playback();
+	Ref<AudioStreamPlayback> skipped_playback = stream->instantiate_playback();
+	mixed_playback->start();
+	skipped_playback->start();
+
+	Vector<AudioFrame> mixed;
+	mixed.resize(BLOCK_SIZE);
+	Vector<AudioFrame> resumed;
+	resumed.resize(BLOCK_SIZE);
+
+	for (int i = 0; i < 16; i++) {
+		CHECK(mixed_playback->mix(mixed.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+		CHECK(skipped_playback->skip(1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	}
+
+	// The skipped playback seeks to its new position when it's mixed again.
+	// Positions may differ by the frames buffered for resampling, a few milliseconds.
+	CHECK(mixed_playback->mix(mixed.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(skipped_playback->mix(resumed.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(Math::abs(skipped_playback->get_playback_position() - mixed_playback->get_playback_position()) < 0.01);
+	CHECK(skipped_playback->is_playing());
+
+	// The resumed playback continues with the sine wave instead of silence.
+	float peak = 0.0;
+	for (const AudioFrame &frame : resumed) {
+		peak = MAX(peak, Math::abs(frame.left));
+	}
+	CHECK(peak > 0.1);
+
+	SUBCASE("Skipping past the end stops the playback") {
+		int skipped = 0;
+		for (int i = 0; i < get_block_count_for_length(stream, 2.0); i++) {
+			skipped = skipped_playback->skip(1.0, BLOCK_SIZE);
+			if (skipped != BLOCK_SIZE) {
+				break;
+			}
+		}
+		CHECK(skipped < BLOCK_SIZE);
+		CHECK_FALSE(skipped_playback->is_playing());
+		CHECK(skipped_playback->get_loop_count() == 0);
+	}
+}
+
+TEST_CASE("[Audio][AudioStreamOggVorbis] Skipping past the end wraps around when looping") {
+	Ref<AudioStreamOggVorbis> stream = load_test_stream();
+	stream->set_loop(true);
+	stream->set_loop_offset(0.5);
+
+	Ref<AudioStreamPlayback> playback = stream->instantiate_playback();
+	playback->start();
+
+	// Skip one and a quarter times the length of the stream.
+	bool skipped_all = true;
+	for (int i = 0; i < get_block_count_for_length(stream, 1.25); i++) {
+		skipped_all = skipped_all && playback->skip(1.0, BLOCK_SIZE) == BLOCK_SIZE;
+	}
+	CHECK(skipped_all);
+	CHECK(playback->is_playing());
+	CHECK(playback->get_loop_count() == 1);
+	CHECK(playback->get_playback_position() >= 0.5);
+	CHECK(playback->get_playback_position() < stream->get_length());
+
+	Vector<AudioFrame> buffer;
+	buffer.resize(BLOCK_SIZE);
+	CHECK(playback->mix(buffer.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(playback->get_playback_position() >= 0.5);
+}
+
+} // namespace TestAudioStreamOggVorbis
@@ -423,11 +423,34 @@ void Skeleton3D::_notification(int p_what) {
 					E->skeleton_version = version;
 				}
 
+				E->bone_buffer.resize(bind_count * 12);
+				float *buffer_ptr = E->bone_buffer.ptrw();
 				for (uint32_t i = 0; i < bind_count; i++) {
 					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
+					// A bind that can't be resolved uploads the identity rather than whatever the slot held before.
+					Transform3D xform;
+					if (likely(bone_index < (uint32_t)len)) {
+						xform = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
+					} else {
+						ERR_PRINT("Skin bind #" + itos(i) + " points to bone " + itos(bone_index) + ", which is out of range.");
+					}
+
+					float *dataptr = buffer_ptr + i * 12;
+					dataptr[0] = xform.basis.rows[0][0];
+					dataptr[1] = xform.basis.rows[0][1];
+					dataptr[2] = xform.basis.rows[0][2];
+					dataptr[3] = xform.origin.x;
+					dataptr[4] = xform.basis.rows[1][0];
+					dataptr[5] = xform.basis.rows[1][1];
+					dataptr[6] = xform.basis.rows[1][2];
+					dataptr[7] = xform.origin.y;
+					dataptr[8] = xform.basis.rows[2][0];
+					dataptr[9] = xform.basis.rows[2][1];
+					dataptr[10] = xform.basis.rows[2][2];
+					dataptr[11] = xform.origin.z;
 				}
+				// A single call instead of one per bone, which matters when the RenderingServer runs on its own thread.
+				rs->skeleton_set_buffer(skeleton, E->bone_buffer);
 			}
 
 			if (!modifiers.is_empty()) {
@@ -51,6 +51,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	Vector<float> bone_buffer; // Skinning transforms in the RenderingServer skeleton layout, uploaded at once.
 
 protected:
 	static void _bind_methods();
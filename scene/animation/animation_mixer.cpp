@@ -35,6 +35,7 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -45,9 +46,12 @@
 
 #ifndef _3D_DISABLED
 #include "scene/3d/audio_stream_player_3d.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/main/viewport.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
@@ -129,6 +133,9 @@ void AnimationMixer::_validate_property(PropertyInfo &p_property) const {
 	if (root_motion_track.is_empty() && p_property.name == "root_motion_local") {
 		p_property.usage = PROPERTY_USAGE_NONE;
 	}
+	if (!lod_enabled && p_property.name.begins_with("lod_") && p_property.name != "lod_enabled") {
+		p_property.usage = PROPERTY_USAGE_NO_EDITOR;
+	}
 }
 
 /* -------------------------------------------- */
@@ -568,6 +575,7 @@ bool AnimationMixer::is_dummy() const {
 /* -------------------------------------------- */
 
 void AnimationMixer::_clear_caches() {
+	_cancel_batched_process();
 	_init_root_motion_cache();
 	_clear_audio_streams();
 	_clear_playing_caches();
@@ -578,6 +586,7 @@ void AnimationMixer::_clear_caches() {
 	animation_track_num_to_track_cache.clear();
 	cache_valid = false;
 	capture_cache.clear();
+	blend_thread_flags_cache.clear();
 
 	emit_signal(SNAME("caches_cleared"));
 }
@@ -897,6 +906,7 @@ bool AnimationMixer::_update_caches() {
 					}
 				}
 				track->path = path;
+				track->lod_skip = lod_reduced_tracks.has(path);
 				track_cache[thash] = track;
 			} else if (track_cache_type == Animation::TYPE_POSITION_3D) {
 				TrackCacheTransform *track_xform = static_cast<TrackCacheTransform *>(track);
@@ -977,11 +987,196 @@ bool AnimationMixer::_update_caches() {
 	return true;
 }
 
+/* -------------------------------------------- */
+/* -- Level of detail ------------------------- */
+/* -------------------------------------------- */
+
+void AnimationMixer::set_lod_enabled(bool p_enabled) {
+	lod_enabled = p_enabled;
+	_lod_reset();
+	notify_property_list_changed();
+}
+
+bool AnimationMixer::is_lod_enabled() const {
+	return lod_enabled;
+}
+
+void AnimationMixer::set_lod_distance_begin(real_t p_distance) {
+	lod_distance_begin = MAX(0.0, p_distance);
+}
+
+real_t AnimationMixer::get_lod_distance_begin() const {
+	return lod_distance_begin;
+}
+
+void AnimationMixer::set_lod_distance_end(real_t p_distance) {
+	lod_distance_end = MAX(0.0, p_distance);
+}
+
+real_t AnimationMixer::get_lod_distance_end() const {
+	return lod_distance_end;
+}
+
+void AnimationMixer::set_lod_max_update_interval(int p_frames) {
+	ERR_FAIL_COND(p_frames < 1);
+	lod_max_update_interval = p_frames;
+}
+
+int AnimationMixer::get_lod_max_update_interval() const {
+	return lod_max_update_interval;
+}
+
+void AnimationMixer::set_lod_interpolate(bool p_interpolate) {
+	lod_interpolate = p_interpolate;
+}
+
+bool AnimationMixer::is_lod_interpolate_enabled() const {
+	return lod_interpolate;
+}
+
+void AnimationMixer::set_lod_reduced_tracks_distance(real_t p_distance) {
+	lod_reduced_tracks_distance = MAX(0.0, p_distance);
+}
+
+real_t AnimationMixer::get_lod_reduced_tracks_distance() const {
+	return lod_reduced_tracks_distance;
+}
+
+void AnimationMixer::set_lod_reduced_tracks(const TypedArray<NodePath> &p_tracks) {
+	lod_reduced_tracks.clear();
+	for (int i = 0; i < p_tracks.size(); i++) {
+		lod_reduced_tracks.insert(p_tracks[i]);
+	}
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		K.value->lod_skip = lod_reduced_tracks.has(K.value->path);
+	}
+}
+
+TypedArray<NodePath> AnimationMixer::get_lod_reduced_tracks() const {
+	TypedArray<NodePath> ret;
+	for (const NodePath &path : lod_reduced_tracks) {
+		ret.push_back(path);
+	}
+	return ret;
+}
+
+void AnimationMixer::set_lod_visibility_notifier(const NodePath &p_path) {
+	lod_visibility_notifier = p_path;
+}
+
+NodePath AnimationMixer::get_lod_visibility_notifier() const {
+	return lod_visibility_notifier;
+}
+
+int AnimationMixer::get_lod_update_interval() const {
+	return lod_update_interval;
+}
+
+void AnimationMixer::_lod_reset() {
+	lod_update_interval = 1;
+	lod_update_step = 0;
+	lod_accumulated_delta = 0.0;
+	lod_reduced = false;
+}
+
+void AnimationMixer::_process_animation_internal(double p_delta) {
+	double delta = p_delta;
+	if (!_lod_advance(delta)) {
+		return;
+	}
+	if (GLOBAL_GET_CACHED(bool, "animation/mixer/parallel_blending") && Thread::is_main_thread()) {
+		_process_animation_batched(delta);
+	} else {
+		_process_animation(delta);
+	}
+}
+
+bool AnimationMixer::_lod_advance(double &r_delta) {
+	if (!lod_enabled) {
+		return true;
+	}
+	lod_accumulated_delta += r_delta;
+	lod_update_step++;
+	if (lod_update_step < lod_update_interval) {
+		// Skipped frame, the time is caught up by the next update.
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		if (lod_interpolate) {
+			_lod_interpolate_pose(real_t(lod_update_step + 1) / lod_update_interval);
+		}
+		return false;
+	}
+	r_delta = lod_accumulated_delta;
+	lod_accumulated_delta = 0.0;
+	lod_update_step = 0;
+	_lod_update_level();
+	return true;
+}
+
+void AnimationMixer::_lod_update_level() {
+	lod_update_interval = 1;
+	lod_reduced = false;
+#ifndef _3D_DISABLED
+	if (!lod_visibility_notifier.is_empty()) {
+		VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(get_node_or_null(lod_visibility_notifier));
+		if (notifier && !notifier->is_on_screen()) {
+			lod_update_interval = lod_max_update_interval;
+			lod_reduced = true;
+			return;
+		}
+	}
+
+	Node3D *root_3d = Object::cast_to<Node3D>(get_node_or_null(root_node));
+	Camera3D *camera = get_viewport() ? get_viewport()->get_camera_3d() : nullptr;
+	if (!root_3d || !camera) {
+		return;
+	}
+	real_t distance = root_3d->get_global_position().distance_to(camera->get_global_position());
+	if (distance > lod_distance_begin) {
+		real_t range = lod_distance_end - lod_distance_begin;
+		real_t amount = range > 0 ? CLAMP((distance - lod_distance_begin) / range, 0.0, 1.0) : 1.0;
+		lod_update_interval = 1 + (int)Math::round(amount * (lod_max_update_interval - 1));
+	}
+	lod_reduced = distance > lod_reduced_tracks_distance;
+#endif // _3D_DISABLED
+}
+
+void AnimationMixer::_lod_interpolate_pose(real_t p_weight) {
+#ifndef _3D_DISABLED
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		if (K.value->type != Animation::TYPE_POSITION_3D) {
+			continue;
+		}
+		TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+		if (!t->lod_interpolating) {
+			continue;
+		}
+		Skeleton3D *t_skeleton = ObjectDB::get_instance<Skeleton3D>(t->skeleton_id);
+		if (!t_skeleton) {
+			continue;
+		}
+		if (t->loc_used) {
+			t_skeleton->set_bone_pose_position(t->bone_idx, t->lod_from_loc.lerp(t->loc, p_weight));
+		}
+		if (t->rot_used) {
+			t_skeleton->set_bone_pose_rotation(t->bone_idx, t->lod_from_rot.normalized().slerp(t->rot.normalized(), p_weight));
+		}
+		if (t->scale_used) {
+			t_skeleton->set_bone_pose_scale(t->bone_idx, t->lod_from_scale.lerp(t->scale, p_weight));
+		}
+	}
+#endif // _3D_DISABLED
+}
+
 /* -------------------------------------------- */
 /* -- Blending processor ---------------------- */
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	if (batch_pending) {
+		_finish_batched_process(); // Keep the order of the frames if processed manually before the batch is flushed.
+	}
 	_blend_init();
 	if (_blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
@@ -994,6 +1189,145 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+/* -------------------------------------------- */
+/* -- Parallel blending ----------------------- */
+/* -------------------------------------------- */
+
+LocalVector<ObjectID> AnimationMixer::batched_mixers;
+bool AnimationMixer::batch_flush_queued = false;
+
+void AnimationMixer::_process_animation_batched(double p_delta) {
+	if (batch_pending) {
+		_finish_batched_process();
+	}
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+	_blend_calc_total_weight();
+	batch_delta = p_delta;
+	batch_pending = true;
+	if (!_can_blend_process_in_thread()) {
+		_finish_batched_process();
+		return;
+	}
+	batched_mixers.push_back(get_instance_id());
+	if (!batch_flush_queued) {
+		// Flushed by the message queue right after the scene tree has finished processing nodes.
+		batch_flush_queued = true;
+		callable_mp_static(&AnimationMixer::_flush_batched_mixers).call_deferred();
+	}
+}
+
+uint32_t AnimationMixer::_get_blend_thread_flags(const Ref<Animation> &p_animation) {
+	const uint32_t *cached_flags = blend_thread_flags_cache.getptr(p_animation->get_instance_id());
+	if (cached_flags) {
+		return *cached_flags;
+	}
+
+	uint32_t flags = 0;
+	const Vector<Animation::Track *> tracks = p_animation->get_tracks();
+	Animation::Track *const *tracks_ptr = tracks.ptr();
+	int count = tracks.size();
+	for (int i = 0; i < count; i++) {
+		const Animation::Track *animation_track = tracks_ptr[i];
+		if (!animation_track->enabled) {
+			continue;
+		}
+		switch (animation_track->type) {
+			case Animation::TYPE_METHOD:
+			case Animation::TYPE_AUDIO:
+			case Animation::TYPE_ANIMATION: {
+				flags |= BLEND_THREAD_FLAG_OBJECT_TRACKS;
+			} break;
+			case Animation::TYPE_VALUE: {
+				if (p_animation->value_track_get_update_mode(i) == Animation::UPDATE_DISCRETE) {
+					flags |= BLEND_THREAD_FLAG_DISCRETE_VALUE_TRACKS;
+				}
+			} break;
+			default: {
+			} break;
+		}
+	}
+	blend_thread_flags_cache.insert(p_animation->get_instance_id(), flags);
+	return flags;
+}
+
+bool AnimationMixer::_can_blend_process_in_thread() {
+	// Method, audio, animation and discrete value tracks touch other objects directly in _blend_process().
+	if (GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		return false;
+	}
+	uint32_t unsafe_flags = BLEND_THREAD_FLAG_OBJECT_TRACKS;
+	if (callback_mode_discrete != ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS) {
+		unsafe_flags |= BLEND_THREAD_FLAG_DISCRETE_VALUE_TRACKS;
+	}
+	for (const AnimationInstance &ai : animation_instances) {
+		if (_get_blend_thread_flags(ai.animation_data.animation) & unsafe_flags) {
+			return false;
+		}
+	}
+	is_GDVIRTUAL_CALL_post_process_key_value = false; // Not overridden, skip the script lookup from the worker threads.
+	return true;
+}
+
+void AnimationMixer::_finish_batched_process() {
+	ERR_FAIL_COND(!batch_pending);
+	if (!batch_blended) {
+		_blend_process(batch_delta);
+	}
+	batch_pending = false;
+	batch_blended = false;
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+	clear_animation_instances();
+}
+
+void AnimationMixer::_cancel_batched_process() {
+	if (!batch_pending) {
+		return;
+	}
+	batch_pending = false;
+	batch_blended = false;
+	clear_animation_instances();
+}
+
+void AnimationMixer::_blend_process_batched(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_process(mixer->batch_delta);
+	mixer->batch_blended = true;
+}
+
+void AnimationMixer::_flush_batched_mixers() {
+	batch_flush_queued = false;
+	LocalVector<ObjectID> ids;
+	SWAP(ids, batched_mixers);
+
+	LocalVector<AnimationMixer *> mixers;
+	mixers.reserve(ids.size());
+	for (const ObjectID &id : ids) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->batch_pending && !mixer->batch_blended) {
+			mixers.push_back(mixer);
+		}
+	}
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_blend_process_batched, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Applying runs user code through setters and signals which may free or reprocess any mixer, so look them up again.
+	for (const ObjectID &id : ids) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->batch_pending) {
+			mixer->_finish_batched_process();
+		}
+	}
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1056,6 +1390,7 @@ void AnimationMixer::_blend_init() {
 				t->loc = t->init_loc;
 				t->rot = t->init_rot;
 				t->scale = t->init_scale;
+				t->lod_interpolating = false;
 			} break;
 			case Animation::TYPE_BLEND_SHAPE: {
 				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
@@ -1191,6 +1526,41 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		real_t a_length = a->get_length();
 		int count = tracks.size();
+		// Decode the compressed tracks that the loop below blends all at once, it falls back to per track interpolation otherwise.
+		// The checks mirror the ones in the loop, so tracks that are skipped there are never decoded.
+		compressed_sample_tracks.clear();
+		if (weight != 0.0) {
+			for (int i = 0; i < count; i++) {
+				const Animation::Track *animation_track = tracks_ptr[i];
+				if (!animation_track->enabled || !a->track_is_compressed(i)) {
+					continue;
+				}
+				const TrackCache *track = track_num_to_track_cache[i];
+				if (track == nullptr || (lod_reduced && track->lod_skip)) {
+					continue;
+				}
+				int blend_idx = track->blend_idx;
+				if (blend_idx < 0 || blend_idx >= track_count) {
+					continue; // Reported by the loop below.
+				}
+				real_t blend = blend_idx < track_weights_count ? track_weights_ptr[blend_idx] * weight : weight;
+				if (!deterministic) {
+					if (Math::is_zero_approx(track->total_weight)) {
+						continue;
+					}
+					blend = blend / track->total_weight;
+				}
+				if (Math::is_zero_approx(blend)) {
+					continue;
+				}
+				compressed_sample_tracks.push_back(i);
+			}
+		}
+		if (compressed_sample_tracks.is_empty()) {
+			compressed_samples.track_to_sample.clear();
+		} else {
+			a->sample_compressed_tracks(time, compressed_samples, &compressed_sample_tracks);
+		}
 		for (int i = 0; i < count; i++) {
 			const Animation::Track *animation_track = tracks_ptr[i];
 			if (!animation_track->enabled) {
@@ -1200,6 +1570,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 			if (track == nullptr) {
 				continue; // No path, but avoid error spamming.
 			}
+			if (lod_reduced && track->lod_skip) {
+				continue; // Keep the last pose of tracks removed by the LOD.
+			}
 			int blend_idx = track->blend_idx;
 			ERR_CONTINUE(blend_idx < 0 || blend_idx >= track_count);
 			real_t blend = blend_idx < track_weights_count ? track_weights_ptr[blend_idx] * weight : weight;
@@ -1348,7 +1721,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
+						Error err = compressed_samples.get_vector3(i, loc) ? OK : a->try_position_track_interpolate(i, time, &loc);
 						if (err != OK) {
 							continue;
 						}
@@ -1436,7 +1809,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
+						Error err = compressed_samples.get_quaternion(i, rot) ? OK : a->try_rotation_track_interpolate(i, time, &rot);
 						if (err != OK) {
 							continue;
 						}
@@ -1524,7 +1897,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
+						Error err = compressed_samples.get_vector3(i, scale) ? OK : a->try_scale_track_interpolate(i, time, &scale);
 						if (err != OK) {
 							continue;
 						}
@@ -1540,7 +1913,7 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+					Error err = compressed_samples.get_blend_shape(i, value) ? OK : a->try_blend_shape_track_interpolate(i, time, &value);
 					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
 					if (err != OK) {
 						continue;
@@ -1856,6 +2229,9 @@ void AnimationMixer::_blend_apply() {
 		if (!deterministic && is_zero_amount) {
 			continue;
 		}
+		if (lod_reduced && track->lod_skip) {
+			continue;
+		}
 		switch (track->type) {
 			case Animation::TYPE_POSITION_3D: {
 #ifndef _3D_DISABLED
@@ -1873,6 +2249,14 @@ void AnimationMixer::_blend_apply() {
 					if (!t_skeleton) {
 						return;
 					}
+					if (lod_interpolate && lod_update_interval > 1) {
+						// Reach the new pose over the frames skipped until the next update, see _lod_interpolate_pose().
+						t->lod_from_loc = t_skeleton->get_bone_pose_position(t->bone_idx);
+						t->lod_from_rot = t_skeleton->get_bone_pose_rotation(t->bone_idx);
+						t->lod_from_scale = t_skeleton->get_bone_pose_scale(t->bone_idx);
+						t->lod_interpolating = true;
+						break;
+					}
 					if (t->loc_used) {
 						t_skeleton->set_bone_pose_position(t->bone_idx, t->loc);
 					}
@@ -2012,6 +2396,10 @@ void AnimationMixer::_blend_apply() {
 			} // The rest don't matter.
 		}
 	}
+
+	if (lod_interpolate && lod_update_interval > 1) {
+		_lod_interpolate_pose(1.0 / lod_update_interval);
+	}
 }
 
 void AnimationMixer::_call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred) {
@@ -2350,13 +2738,13 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				_process_animation_internal(get_process_delta_time());
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				_process_animation_internal(get_physics_process_delta_time());
 			}
 		} break;
 
@@ -2437,6 +2825,25 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_root_motion_rotation_accumulator"), &AnimationMixer::get_root_motion_rotation_accumulator);
 	ClassDB::bind_method(D_METHOD("get_root_motion_scale_accumulator"), &AnimationMixer::get_root_motion_scale_accumulator);
 
+	/* ---- Level of detail ---- */
+	ClassDB::bind_method(D_METHOD("set_lod_enabled", "enabled"), &AnimationMixer::set_lod_enabled);
+	ClassDB::bind_method(D_METHOD("is_lod_enabled"), &AnimationMixer::is_lod_enabled);
+	ClassDB::bind_method(D_METHOD("set_lod_distance_begin", "distance"), &AnimationMixer::set_lod_distance_begin);
+	ClassDB::bind_method(D_METHOD("get_lod_distance_begin"), &AnimationMixer::get_lod_distance_begin);
+	ClassDB::bind_method(D_METHOD("set_lod_distance_end", "distance"), &AnimationMixer::set_lod_distance_end);
+	ClassDB::bind_method(D_METHOD("get_lod_distance_end"), &AnimationMixer::get_lod_distance_end);
+	ClassDB::bind_method(D_METHOD("set_lod_max_update_interval", "frames"), &AnimationMixer::set_lod_max_update_interval);
+	ClassDB::bind_method(D_METHOD("get_lod_max_update_interval"), &AnimationMixer::get_lod_max_update_interval);
+	ClassDB::bind_method(D_METHOD("set_lod_interpolate", "interpolate"), &AnimationMixer::set_lod_interpolate);
+	ClassDB::bind_method(D_METHOD("is_lod_interpolate_enabled"), &AnimationMixer::is_lod_interpolate_enabled);
+	ClassDB::bind_method(D_METHOD("set_lod_reduced_tracks_distance", "distance"), &AnimationMixer::set_lod_reduced_tracks_distance);
+	ClassDB::bind_method(D_METHOD("get_lod_reduced_tracks_distance"), &AnimationMixer::get_lod_reduced_tracks_distance);
+	ClassDB::bind_method(D_METHOD("set_lod_reduced_tracks", "tracks"), &AnimationMixer::set_lod_reduced_tracks);
+	ClassDB::bind_method(D_METHOD("get_lod_reduced_tracks"), &AnimationMixer::get_lod_reduced_tracks);
+	ClassDB::bind_method(D_METHOD("set_lod_visibility_notifier", "path"), &AnimationMixer::set_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_visibility_notifier"), &AnimationMixer::get_lod_visibility_notifier);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval"), &AnimationMixer::get_lod_update_interval);
+
 	/* ---- Blending processor ---- */
 	ClassDB::bind_method(D_METHOD("clear_caches"), &AnimationMixer::clear_caches);
 	ClassDB::bind_method(D_METHOD("advance", "delta"), &AnimationMixer::advance);
@@ -2461,6 +2868,16 @@ void AnimationMixer::_bind_methods() {
 	ADD_GROUP("Audio", "audio_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "audio_max_polyphony", PropertyHint::HINT_RANGE, "1,127,1"), "set_audio_max_polyphony", "get_audio_max_polyphony");
 
+	ADD_GROUP("LOD", "lod_");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_enabled"), "set_lod_enabled", "is_lod_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance_begin", PropertyHint::HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance_begin", "get_lod_distance_begin");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_distance_end", PropertyHint::HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_distance_end", "get_lod_distance_end");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_max_update_interval", PropertyHint::HINT_RANGE, "1,16,1,or_greater"), "set_lod_max_update_interval", "get_lod_max_update_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_interpolate"), "set_lod_interpolate", "is_lod_interpolate_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "lod_reduced_tracks_distance", PropertyHint::HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), "set_lod_reduced_tracks_distance", "get_lod_reduced_tracks_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "lod_reduced_tracks", PropertyHint::HINT_ARRAY_TYPE, "NodePath"), "set_lod_reduced_tracks", "get_lod_reduced_tracks");
+	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "lod_visibility_notifier", PropertyHint::HINT_NODE_PATH_VALID_TYPES, "VisibleOnScreenNotifier3D"), "set_lod_visibility_notifier", "get_lod_visibility_notifier");
+
 	ADD_GROUP("Callback Mode", "callback_mode_");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_process", PropertyHint::HINT_ENUM, "Physics,Idle,Manual"), "set_callback_mode_process", "get_callback_mode_process");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "callback_mode_method", PropertyHint::HINT_ENUM, "Deferred,Immediate"), "set_callback_mode_method", "get_callback_mode_method");
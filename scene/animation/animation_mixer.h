@@ -44,6 +44,7 @@ class AnimatedValuesBackup;
 class AnimationMixer : public Node {
 	GDCLASS(AnimationMixer, Node);
 	friend AnimatedValuesBackup;
+	friend class TestAnimationMixerInternalsAccessor;
 #ifdef TOOLS_ENABLED
 	bool editing = false;
 	bool dummy = false;
@@ -153,6 +154,7 @@ protected:
 		int blend_idx = -1;
 		ObjectID object_id;
 		real_t total_weight = 0.0;
+		bool lod_skip = false; // Listed in lod_reduced_tracks.
 
 		TrackCache() = default;
 		TrackCache(const TrackCache &p_other) :
@@ -160,7 +162,8 @@ protected:
 				setup_pass(p_other.setup_pass),
 				type(p_other.type),
 				object_id(p_other.object_id),
-				total_weight(p_other.total_weight) {}
+				total_weight(p_other.total_weight),
+				lod_skip(p_other.lod_skip) {}
 
 		virtual ~TrackCache() {}
 	};
@@ -179,6 +182,10 @@ protected:
 		Vector3 loc;
 		Quaternion rot;
 		Vector3 scale;
+		bool lod_interpolating = false;
+		Vector3 lod_from_loc;
+		Quaternion lod_from_rot;
+		Vector3 lod_from_scale;
 
 		TrackCacheTransform(const TrackCacheTransform &p_other) :
 				TrackCache(p_other),
@@ -332,6 +339,8 @@ protected:
 	AHashMap<NodePath, int> track_map;
 	int track_count = 0;
 	bool deterministic = false;
+	Animation::CompressedSamples compressed_samples;
+	LocalVector<int32_t> compressed_sample_tracks;
 
 	/* ---- Root motion accumulator for Skeleton3D ---- */
 	NodePath root_motion_track;
@@ -343,6 +352,27 @@ protected:
 	Quaternion root_motion_rotation_accumulator = Quaternion(0, 0, 0, 1);
 	Vector3 root_motion_scale_accumulator = Vector3(1, 1, 1);
 
+	/* ---- Level of detail ---- */
+	bool lod_enabled = false;
+	real_t lod_distance_begin = 20.0;
+	real_t lod_distance_end = 100.0;
+	int lod_max_update_interval = 4;
+	bool lod_interpolate = true;
+	real_t lod_reduced_tracks_distance = 50.0;
+	HashSet<NodePath> lod_reduced_tracks;
+	NodePath lod_visibility_notifier;
+
+	int lod_update_interval = 1; // In frames, chosen at the last update.
+	int lod_update_step = 0;
+	double lod_accumulated_delta = 0.0;
+	bool lod_reduced = false;
+
+	void _lod_reset();
+	bool _lod_advance(double &r_delta);
+	void _lod_update_level();
+	void _lod_interpolate_pose(real_t p_weight);
+	void _process_animation_internal(double p_delta);
+
 	bool _set(const StringName &p_name, const Variant &p_value);
 	bool _get(const StringName &p_name, Variant &r_ret) const;
 	void _get_property_list(List<PropertyInfo> *p_list) const;
@@ -364,6 +394,30 @@ protected:
 	/* ---- Blending processor ---- */
 	virtual void _process_animation(double p_delta, bool p_update_only = false);
 
+	/* ---- Parallel blending ---- */
+	// Mixers processed by the scene tree may defer _blend_process() so that it runs for all of them at once on the WorkerThreadPool.
+	// Blending only writes into the mixer's own track caches, the rest of the pipeline stays on the main thread.
+	bool batch_pending = false;
+	bool batch_blended = false;
+	double batch_delta = 0.0;
+	static LocalVector<ObjectID> batched_mixers;
+	static bool batch_flush_queued;
+
+	// Per animation, the kinds of tracks that touch other objects when blended. Cleared with the other caches when an animation changes.
+	enum BlendThreadFlags {
+		BLEND_THREAD_FLAG_OBJECT_TRACKS = 1, // Method, audio or animation tracks.
+		BLEND_THREAD_FLAG_DISCRETE_VALUE_TRACKS = 2,
+	};
+	HashMap<ObjectID, uint32_t> blend_thread_flags_cache;
+
+	void _process_animation_batched(double p_delta);
+	uint32_t _get_blend_thread_flags(const Ref<Animation> &p_animation);
+	bool _can_blend_process_in_thread();
+	void _finish_batched_process();
+	void _cancel_batched_process();
+	static void _blend_process_batched(void *p_userdata, uint32_t p_index);
+	static void _flush_batched_mixers();
+
 	// For post process with retrieved key value during blending.
 	virtual Variant _post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
 	Variant post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
@@ -460,6 +514,33 @@ public:
 	Quaternion get_root_motion_rotation_accumulator() const;
 	Vector3 get_root_motion_scale_accumulator() const;
 
+	/* ---- Level of detail ---- */
+	void set_lod_enabled(bool p_enabled);
+	bool is_lod_enabled() const;
+
+	void set_lod_distance_begin(real_t p_distance);
+	real_t get_lod_distance_begin() const;
+
+	void set_lod_distance_end(real_t p_distance);
+	real_t get_lod_distance_end() const;
+
+	void set_lod_max_update_interval(int p_frames);
+	int get_lod_max_update_interval() const;
+
+	void set_lod_interpolate(bool p_interpolate);
+	bool is_lod_interpolate_enabled() const;
+
+	void set_lod_reduced_tracks_distance(real_t p_distance);
+	real_t get_lod_reduced_tracks_distance() const;
+
+	void set_lod_reduced_tracks(const TypedArray<NodePath> &p_tracks);
+	TypedArray<NodePath> get_lod_reduced_tracks() const;
+
+	void set_lod_visibility_notifier(const NodePath &p_path);
+	NodePath get_lod_visibility_notifier() const;
+
+	int get_lod_update_interval() const;
+
 	/* ---- Blending processor ---- */
 	void make_animation_instance(const StringName &p_name, const PlaybackInfo p_playback_info);
 	void clear_animation_instances();
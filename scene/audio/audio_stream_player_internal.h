@@ -78,6 +78,7 @@ public:
 	bool autoplay = false;
 	StringName bus;
 	int max_polyphony = 1;
+	int voice_priority = 0;
 
 	void process();
 	void ensure_playback_limit();
@@ -91,6 +92,7 @@ public:
 	void set_stream(Ref<AudioStream> p_stream);
 	void set_pitch_scale(float p_pitch_scale);
 	void set_max_polyphony(int p_max_polyphony);
+	void set_voice_priority(int p_voice_priority);
 
 	StringName get_bus() const;
 
@@ -5321,29 +5321,39 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 	return true;
 }
 
+int32_t Animation::_find_compressed_page(double p_time) const {
+	int32_t page_index = -1;
+	for (uint32_t i = 0; i < compression.pages.size(); i++) {
+		if (compression.pages[i].time_offset > p_time) {
+			break;
+		}
+		page_index = i;
+	}
+	return page_index;
+}
+
 template <uint32_t COMPONENTS>
 bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
+
+	int32_t page_index = _find_compressed_page(p_time);
+	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+
+	return _fetch_compressed_in_page<COMPONENTS>(page_index, p_compressed_track, p_time, r_current_value, r_current_time, r_next_value, r_next_time, key_index);
+}
+
+template <uint32_t COMPONENTS>
+bool Animation::_fetch_compressed_in_page(uint32_t p_page, uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
 	if (key_index) {
 		*key_index = 0;
 	}
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
-		}
-		page_index = i;
-	}
-
-	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
-
-	double page_base_time = compression.pages[page_index].time_offset;
-	const uint8_t *page_data = compression.pages[page_index].data.ptr();
+	double page_base_time = compression.pages[p_page].time_offset;
+	const uint8_t *page_data = compression.pages[p_page].data.ptr();
 	// Little endian assumed. No major big endian hardware exists any longer, but in case it does it will need to be supported.
 	const uint32_t *indices = (const uint32_t *)page_data;
 	const uint16_t *time_keys = (const uint16_t *)&page_data[indices[p_compressed_track * 3 + 0]];
@@ -5570,6 +5580,182 @@ int Animation::_get_compressed_key_count(uint32_t p_compressed_track) const {
 	return key_count;
 }
 
+bool Animation::sample_compressed_tracks(double p_time, CompressedSamples &r_samples, const LocalVector<int32_t> *p_tracks) const {
+	r_samples.track_to_sample.clear();
+	if (!compression.enabled) {
+		return false;
+	}
+	p_time = CLAMP(p_time, 0, length);
+
+	int32_t page_index = _find_compressed_page(p_time);
+	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+
+	// Samples are packed densely in request order, so the cost follows the number of requested tracks.
+	int track_count = tracks.size();
+	uint32_t request_count = p_tracks ? p_tracks->size() : uint32_t(track_count);
+	r_samples.track_to_sample.resize(track_count);
+	for (int i = 0; i < track_count; i++) {
+		r_samples.track_to_sample[i] = -1;
+	}
+	r_samples.compressed_tracks.resize(request_count);
+	r_samples.types.resize(request_count);
+	r_samples.x.resize(request_count);
+	r_samples.y.resize(request_count);
+	r_samples.z.resize(request_count);
+	r_samples.rotations.resize(request_count);
+	r_samples.weight.resize(request_count);
+	for (uint32_t i = 0; i < 3; i++) {
+		r_samples.from[i].resize(request_count);
+		r_samples.to[i].resize(request_count);
+	}
+
+	// Decode the keys around the requested time. The bit packed deltas can only be read serially.
+	uint32_t sample_count = 0;
+	for (uint32_t r = 0; r < request_count; r++) {
+		int i = p_tracks ? (*p_tracks)[r] : int(r);
+		ERR_CONTINUE(i < 0 || i >= track_count);
+		const Track *t = tracks[i];
+		int32_t compressed_track = -1;
+		CompressedSamples::SampleType type = CompressedSamples::SAMPLE_TYPE_NONE;
+		switch (t->type) {
+			case TYPE_POSITION_3D: {
+				compressed_track = static_cast<const PositionTrack *>(t)->compressed_track;
+				type = CompressedSamples::SAMPLE_TYPE_POSITION_SCALE;
+			} break;
+			case TYPE_ROTATION_3D: {
+				compressed_track = static_cast<const RotationTrack *>(t)->compressed_track;
+				type = CompressedSamples::SAMPLE_TYPE_ROTATION;
+			} break;
+			case TYPE_SCALE_3D: {
+				compressed_track = static_cast<const ScaleTrack *>(t)->compressed_track;
+				type = CompressedSamples::SAMPLE_TYPE_POSITION_SCALE;
+			} break;
+			case TYPE_BLEND_SHAPE: {
+				compressed_track = static_cast<const BlendShapeTrack *>(t)->compressed_track;
+				type = CompressedSamples::SAMPLE_TYPE_BLEND_SHAPE;
+			} break;
+			default: {
+			} break;
+		}
+		if (compressed_track < 0 || (uint32_t)compressed_track >= compression.bounds.size()) {
+			continue;
+		}
+
+		Vector3i current;
+		Vector3i next;
+		double time_current;
+		double time_next;
+		bool ok;
+		if (type == CompressedSamples::SAMPLE_TYPE_BLEND_SHAPE) {
+			ok = _fetch_compressed_in_page<1>(page_index, compressed_track, p_time, current, time_current, next, time_next);
+		} else {
+			ok = _fetch_compressed_in_page<3>(page_index, compressed_track, p_time, current, time_current, next, time_next);
+		}
+		if (!ok) {
+			continue;
+		}
+
+		uint32_t s = sample_count++;
+		r_samples.track_to_sample[i] = s;
+		r_samples.compressed_tracks[s] = compressed_track;
+		r_samples.types[s] = type;
+
+		double c;
+		if (time_current >= p_time || time_current == time_next) {
+			c = 0.0;
+		} else if (p_time >= time_next) {
+			c = 1.0;
+		} else {
+			c = (p_time - time_current) / (time_next - time_current);
+		}
+
+		if (type == CompressedSamples::SAMPLE_TYPE_ROTATION) {
+			// Octahedral encoding does not interpolate linearly, so rotations are resolved here.
+			Quaternion from = _uncompress_quaternion(current);
+			r_samples.rotations[s] = c == 0.0 ? from : (c == 1.0 ? _uncompress_quaternion(next) : from.slerp(_uncompress_quaternion(next), c));
+			r_samples.weight[s] = 0.0f;
+			for (uint32_t j = 0; j < 3; j++) {
+				r_samples.from[j][s] = 0.0f;
+				r_samples.to[j][s] = 0.0f;
+			}
+			continue;
+		}
+
+		r_samples.weight[s] = c;
+		for (uint32_t j = 0; j < 3; j++) {
+			r_samples.from[j][s] = float(current[j]) / 65535.0f;
+			r_samples.to[j][s] = float(next[j]) / 65535.0f;
+		}
+	}
+
+	// Interpolate the normalized keys of all tracks at once. The mapping to the final range is affine, so it can be applied afterwards.
+	// These loops are branch-free over contiguous arrays so the compiler can vectorize them.
+	const float *weight_ptr = r_samples.weight.ptr();
+	float *out[3] = { r_samples.x.ptr(), r_samples.y.ptr(), r_samples.z.ptr() };
+	for (uint32_t j = 0; j < 3; j++) {
+		const float *from_ptr = r_samples.from[j].ptr();
+		const float *to_ptr = r_samples.to[j].ptr();
+		float *out_ptr = out[j];
+		for (uint32_t i = 0; i < sample_count; i++) {
+			out_ptr[i] = from_ptr[i] + (to_ptr[i] - from_ptr[i]) * weight_ptr[i];
+		}
+	}
+
+	for (uint32_t i = 0; i < sample_count; i++) {
+		switch (r_samples.types[i]) {
+			case CompressedSamples::SAMPLE_TYPE_POSITION_SCALE: {
+				const AABB &bounds = compression.bounds[r_samples.compressed_tracks[i]];
+				r_samples.x[i] = bounds.position.x + r_samples.x[i] * bounds.size.x;
+				r_samples.y[i] = bounds.position.y + r_samples.y[i] * bounds.size.y;
+				r_samples.z[i] = bounds.position.z + r_samples.z[i] * bounds.size.z;
+			} break;
+			case CompressedSamples::SAMPLE_TYPE_BLEND_SHAPE: {
+				r_samples.x[i] = (r_samples.x[i] * 2.0f - 1.0f) * float(Compression::BLEND_SHAPE_RANGE);
+			} break;
+			default: {
+			} break;
+		}
+	}
+
+	return true;
+}
+
+bool Animation::CompressedSamples::get_vector3(int p_track, Vector3 &r_value) const {
+	if ((uint32_t)p_track >= track_to_sample.size()) {
+		return false;
+	}
+	int32_t sample = track_to_sample[p_track];
+	if (sample < 0 || types[sample] != SAMPLE_TYPE_POSITION_SCALE) {
+		return false;
+	}
+	r_value = Vector3(x[sample], y[sample], z[sample]);
+	return true;
+}
+
+bool Animation::CompressedSamples::get_quaternion(int p_track, Quaternion &r_value) const {
+	if ((uint32_t)p_track >= track_to_sample.size()) {
+		return false;
+	}
+	int32_t sample = track_to_sample[p_track];
+	if (sample < 0 || types[sample] != SAMPLE_TYPE_ROTATION) {
+		return false;
+	}
+	r_value = rotations[sample];
+	return true;
+}
+
+bool Animation::CompressedSamples::get_blend_shape(int p_track, float &r_value) const {
+	if ((uint32_t)p_track >= track_to_sample.size()) {
+		return false;
+	}
+	int32_t sample = track_to_sample[p_track];
+	if (sample < 0 || types[sample] != SAMPLE_TYPE_BLEND_SHAPE) {
+		return false;
+	}
+	r_value = x[sample];
+	return true;
+}
+
 Quaternion Animation::_uncompress_quaternion(const Vector3i &p_value) const {
 	Vector3 axis = Vector3::octahedron_decode(Vector2(float(p_value.x) / 65535.0, float(p_value.y) / 65535.0));
 	float angle = (float(p_value.z) / 65535.0) * 2.0 * Math::PI;
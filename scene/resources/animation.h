@@ -362,9 +362,12 @@ private:
 	bool _rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const;
 	bool _pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const;
 	bool _blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const;
+	int32_t _find_compressed_page(double p_time) const;
 	template <uint32_t COMPONENTS>
 	bool _fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr) const;
 	template <uint32_t COMPONENTS>
+	bool _fetch_compressed_in_page(uint32_t p_page, uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr) const;
+	template <uint32_t COMPONENTS>
 	bool _fetch_compressed_by_index(uint32_t p_compressed_track, int p_index, Vector3i &r_value, double &r_time) const;
 	int _get_compressed_key_count(uint32_t p_compressed_track) const;
 	template <uint32_t COMPONENTS>
@@ -541,6 +544,33 @@ public:
 	void optimize(real_t p_allowed_velocity_err = 0.01, real_t p_allowed_angular_err = 0.01, int p_precision = 3);
 	void compress(uint32_t p_page_size = 8192, uint32_t p_fps = 120, float p_split_tolerance = 4.0); // 4.0 seems to be the split tolerance sweet spot from many tests.
 
+	// Bulk sampling of compressed tracks. The page for the given time is looked up once and every compressed track is decoded into
+	// SoA buffers, so interpolation runs over contiguous arrays instead of one key at a time per track.
+	struct CompressedSamples {
+		enum SampleType : uint8_t {
+			SAMPLE_TYPE_NONE,
+			SAMPLE_TYPE_POSITION_SCALE,
+			SAMPLE_TYPE_ROTATION,
+			SAMPLE_TYPE_BLEND_SHAPE,
+		};
+
+		LocalVector<int32_t> track_to_sample; // -1 if the track was not sampled.
+		LocalVector<uint32_t> compressed_tracks;
+		LocalVector<uint8_t> types;
+		LocalVector<float> x, y, z; // Position and scale use XYZ, blend shape uses X.
+		LocalVector<Quaternion> rotations;
+
+		// Scratch buffers holding the normalized keys around the sampled time.
+		LocalVector<float> from[3];
+		LocalVector<float> to[3];
+		LocalVector<float> weight;
+
+		bool get_vector3(int p_track, Vector3 &r_value) const;
+		bool get_quaternion(int p_track, Quaternion &r_value) const;
+		bool get_blend_shape(int p_track, float &r_value) const;
+	};
+	bool sample_compressed_tracks(double p_time, CompressedSamples &r_samples, const LocalVector<int32_t> *p_tracks = nullptr) const;
+
 	// Helper functions for Variant.
 	static bool is_variant_interpolatable(const Variant p_value);
 
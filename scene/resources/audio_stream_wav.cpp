@@ -217,8 +217,20 @@ void AudioStreamPlaybackWAV::decode_samples(const Depth *p_src, AudioFrame *p_ds
 }
 
 int AudioStreamPlaybackWAV::_mix_internal(AudioFrame *p_buffer, int p_frames) {
+	return _advance(p_buffer, p_frames);
+}
+
+int AudioStreamPlaybackWAV::_skip_internal(int p_frames) {
+	if (base->format == AudioStreamWAV::FORMAT_IMA_ADPCM) {
+		// The decoder state depends on every previous sample.
+		return AudioStreamPlaybackResampled::_skip_internal(p_frames);
+	}
+	return _advance(nullptr, p_frames);
+}
+
+int AudioStreamPlaybackWAV::_advance(AudioFrame *p_buffer, int p_frames) {
 	if (base->data.is_empty() || !active) {
-		for (int i = 0; i < p_frames; i++) {
+		for (int i = 0; p_buffer && i < p_frames; i++) {
 			p_buffer[i] = AudioFrame(0, 0);
 		}
 		return 0;
@@ -353,6 +365,12 @@ int AudioStreamPlaybackWAV::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 
 		todo -= target;
 
+		if (!dst_buff) {
+			// Skipping, move without decoding.
+			offset += int64_t(target) * increment;
+			continue;
+		}
+
 		switch (base->format) {
 			case AudioStreamWAV::FORMAT_8_BITS: {
 				if (is_stereo) {
@@ -393,7 +411,7 @@ int AudioStreamPlaybackWAV::_mix_internal(AudioFrame *p_buffer, int p_frames) {
 		int mixed_frames = p_frames - todo;
 		//bit was missing from mix
 		int todo_ofs = p_frames - todo;
-		for (int i = todo_ofs; i < p_frames; i++) {
+		for (int i = todo_ofs; p_buffer && i < p_frames; i++) {
 			p_buffer[i] = AudioFrame(0, 0);
 		}
 		return mixed_frames;
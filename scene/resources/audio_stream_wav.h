@@ -68,12 +68,15 @@ class AudioStreamPlaybackWAV : public AudioStreamPlaybackResampled {
 
 	template <typename Depth, bool is_stereo, bool is_ima_adpcm, bool is_qoa>
 	void decode_samples(const Depth *p_src, AudioFrame *p_dst, int64_t &p_offset, int8_t &p_increment, uint32_t p_amount, IMA_ADPCM_State *p_ima_adpcm, QOA_State *p_qoa);
+	// Decodes into `p_buffer`, or only moves the playback position if it's null (not supported for IMA ADPCM).
+	int _advance(AudioFrame *p_buffer, int p_frames);
 
 	bool _is_sample = false;
 	Ref<AudioSamplePlayback> sample_playback;
 
 protected:
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames) override;
+	virtual int _skip_internal(int p_frames) override;
 	virtual float get_stream_sampling_rate() override;
 
 public:
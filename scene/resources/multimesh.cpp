@@ -209,6 +209,16 @@ void MultiMesh::set_buffer(const Vector<float> &p_buffer) {
 	RS::get_singleton()->multimesh_set_buffer(multimesh, p_buffer);
 }
 
+void MultiMesh::set_buffer_range(int p_from_instance, const Vector<float> &p_buffer) {
+	uint32_t stride = transform_format == TRANSFORM_2D ? 8 : 12;
+	stride += use_colors ? 4 : 0;
+	stride += use_custom_data ? 4 : 0;
+	ERR_FAIL_COND_MSG(p_buffer.size() % stride != 0, vformat("The buffer size must be a multiple of the instance stride (%d floats).", stride));
+	ERR_FAIL_COND_MSG(p_from_instance < 0 || p_from_instance + int(p_buffer.size() / stride) > instance_count, "The buffer range is outside of the MultiMesh's instances.");
+
+	RS::get_singleton()->multimesh_set_buffer_range(multimesh, p_from_instance, p_buffer);
+}
+
 Vector<float> MultiMesh::get_buffer() const {
 	return RS::get_singleton()->multimesh_get_buffer(multimesh);
 }
@@ -390,6 +400,7 @@ void MultiMesh::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_buffer"), &MultiMesh::get_buffer);
 	ClassDB::bind_method(D_METHOD("set_buffer", "buffer"), &MultiMesh::set_buffer);
+	ClassDB::bind_method(D_METHOD("set_buffer_range", "from_instance", "buffer"), &MultiMesh::set_buffer_range);
 
 	ClassDB::bind_method(D_METHOD("set_buffer_interpolated", "buffer_curr", "buffer_prev"), &MultiMesh::set_buffer_interpolated);
 
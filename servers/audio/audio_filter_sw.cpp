@@ -250,15 +250,48 @@ void AudioFilterSW::Processor::process(float *p_samples, int p_amount, int p_str
 		return;
 	}
 
+	// Work on local copies: the samples could alias the members, which would force the compiler
+	// to store and reload the whole filter state on every sample.
+	Coeffs c = coeffs;
+	float a1 = ha1;
+	float a2 = ha2;
+	float b1 = hb1;
+	float b2 = hb2;
+
 	if (p_interpolate) {
+		const Coeffs incr = incr_coeffs;
 		for (int i = 0; i < p_amount; i++) {
-			process_one_interp(*p_samples);
+			float pre = *p_samples;
+			float out = pre * c.b0 + b1 * c.b1 + b2 * c.b2 + a1 * c.a1 + a2 * c.a2;
+			a2 = a1;
+			b2 = b1;
+			b1 = pre;
+			a1 = out;
+			*p_samples = out;
 			p_samples += p_stride;
+
+			c.b0 += incr.b0;
+			c.b1 += incr.b1;
+			c.b2 += incr.b2;
+			c.a1 += incr.a1;
+			c.a2 += incr.a2;
 		}
+		coeffs = c;
 	} else {
 		for (int i = 0; i < p_amount; i++) {
-			process_one(*p_samples);
+			float pre = *p_samples;
+			float out = pre * c.b0 + b1 * c.b1 + b2 * c.b2 + a1 * c.a1 + a2 * c.a2;
+			a2 = a1;
+			b2 = b1;
+			b1 = pre;
+			a1 = out;
+			*p_samples = out;
 			p_samples += p_stride;
 		}
 	}
+
+	ha1 = a1;
+	ha2 = a2;
+	hb1 = b1;
+	hb2 = b2;
 }
@@ -77,6 +77,21 @@ int AudioStreamPlayback::mix(AudioFrame *p_buffer, float p_rate_scale, int p_fra
 	return ret;
 }
 
+int AudioStreamPlayback::skip(float p_rate_scale, int p_frames) {
+	// Generic fallback, mix and discard.
+	AudioFrame discard[256];
+	int skipped = 0;
+	while (skipped < p_frames) {
+		int to_mix = MIN(p_frames - skipped, 256);
+		int mixed = mix(discard, p_rate_scale, to_mix);
+		skipped += mixed;
+		if (mixed < to_mix) {
+			break;
+		}
+	}
+	return skipped;
+}
+
 PackedVector2Array AudioStreamPlayback::_mix_audio_bind(float p_rate_scale, int p_frames) {
 	Vector<AudioFrame> frames = mix_audio(p_rate_scale, p_frames);
 
@@ -172,6 +187,14 @@ void AudioStreamPlaybackResampled::begin_resample() {
 	//mix buffer
 	_mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
 	mix_offset = 0;
+	refill_pending = false;
+}
+
+uint64_t AudioStreamPlaybackResampled::_get_mix_increment(float p_rate_scale) {
+	float target_rate = AudioServer::get_singleton()->get_mix_rate();
+	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
+
+	return uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
 }
 
 int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_frames) {
@@ -179,6 +202,20 @@ int AudioStreamPlaybackResampled::_mix_internal(AudioFrame *p_buffer, int p_fram
 	GDVIRTUAL_CALL(_mix_resampled, p_buffer, p_frames, ret);
 	return ret;
 }
+
+int AudioStreamPlaybackResampled::_skip_internal(int p_frames) {
+	AudioFrame discard[INTERNAL_BUFFER_LEN];
+	int skipped = 0;
+	while (skipped < p_frames) {
+		int to_mix = MIN(p_frames - skipped, (int)INTERNAL_BUFFER_LEN);
+		int mixed = _mix_internal(discard, to_mix);
+		skipped += mixed;
+		if (mixed < to_mix) {
+			break;
+		}
+	}
+	return skipped;
+}
 float AudioStreamPlaybackResampled::get_stream_sampling_rate() {
 	float ret = 0;
 	GDVIRTUAL_CALL(_get_stream_sampling_rate, ret);
@@ -193,10 +230,18 @@ void AudioStreamPlaybackResampled::_bind_methods() {
 }
 
 int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) {
-	float target_rate = AudioServer::get_singleton()->get_mix_rate();
-	float playback_speed_scale = AudioServer::get_singleton()->get_playback_speed_scale();
+	uint64_t mix_increment = _get_mix_increment(p_rate_scale);
 
-	uint64_t mix_increment = uint64_t(((get_stream_sampling_rate() * p_rate_scale * playback_speed_scale) / double(target_rate)) * double(FP_LEN));
+	if (refill_pending) {
+		// Resume after skipping, the interpolation history is lost.
+		internal_buffer[0] = AudioFrame(0.0, 0.0);
+		internal_buffer[1] = AudioFrame(0.0, 0.0);
+		internal_buffer[2] = AudioFrame(0.0, 0.0);
+		internal_buffer[3] = AudioFrame(0.0, 0.0);
+		int mixed_frames = _mix_internal(internal_buffer + 4, INTERNAL_BUFFER_LEN);
+		internal_buffer_end = mixed_frames != INTERNAL_BUFFER_LEN ? mixed_frames : -1;
+		refill_pending = false;
+	}
 
 	int mixed_frames_total = -1;
 
@@ -248,6 +293,44 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 	return mixed_frames_total;
 }
 
+int AudioStreamPlaybackResampled::skip(float p_rate_scale, int p_frames) {
+	uint64_t mix_increment = _get_mix_increment(p_rate_scale);
+	if (mix_increment == 0) {
+		return p_frames;
+	}
+
+	uint64_t start_offset = mix_offset;
+	mix_offset += mix_increment * p_frames;
+
+	if (!refill_pending && internal_buffer_end != (unsigned int)-1 && CUBIC_INTERP_HISTORY + (mix_offset >> FP_BITS) >= internal_buffer_end) {
+		// The stream ends within the frames already in the internal buffer, count the frames `mix` would have produced.
+		uint64_t end_offset = uint64_t(MAX(int(internal_buffer_end) - CUBIC_INTERP_HISTORY, 0)) << FP_BITS;
+		if (end_offset <= start_offset) {
+			return 0;
+		}
+		return MIN(int((end_offset - start_offset + mix_increment - 1) / mix_increment), p_frames - 1);
+	}
+
+	// Frames left in the internal buffer are consumed without being resampled. Past them, the stream
+	// is skipped directly and the buffer is refilled from the new position on the next mix.
+	uint64_t buffered = refill_pending ? 0 : INTERNAL_BUFFER_LEN;
+	uint64_t position = mix_offset >> FP_BITS;
+	if (position < buffered) {
+		return p_frames;
+	}
+
+	int to_skip = position - buffered;
+	int skipped = _skip_internal(to_skip);
+	mix_offset &= FP_MASK;
+	refill_pending = true;
+
+	if (skipped < to_skip) {
+		uint64_t missing_frames = (uint64_t(to_skip - skipped) << FP_BITS) / mix_increment;
+		return p_frames - int(MIN(missing_frames + 1, (uint64_t)p_frames));
+	}
+	return p_frames;
+}
+
 ////////////////////////////////
 
 Ref<AudioStreamPlayback> AudioStream::instantiate_playback() {
@@ -110,6 +110,9 @@ public:
 	virtual Variant get_parameter(const StringName &p_name) const;
 
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames);
+	// Advances the playback as if `mix` had been called, without producing audio. Used for virtual voices.
+	// Returns the number of frames skipped, which is less than `p_frames` if the stream ended.
+	virtual int skip(float p_rate_scale, int p_frames);
 
 	virtual void set_is_sample(bool p_is_sample) {}
 	virtual bool get_is_sample() const { return false; }
@@ -139,11 +142,17 @@ class AudioStreamPlaybackResampled : public AudioStreamPlayback {
 	AudioFrame internal_buffer[INTERNAL_BUFFER_LEN + CUBIC_INTERP_HISTORY];
 	unsigned int internal_buffer_end = -1;
 	uint64_t mix_offset = 0;
+	bool refill_pending = false; // The internal buffer was skipped over and must be refilled before mixing.
+
+	uint64_t _get_mix_increment(float p_rate_scale);
 
 protected:
 	void begin_resample();
 	// Returns the number of frames that were mixed.
 	virtual int _mix_internal(AudioFrame *p_buffer, int p_frames);
+	// Returns the number of frames that were skipped. The default implementation decodes and discards them,
+	// streams which can move their position without decoding should override it.
+	virtual int _skip_internal(int p_frames);
 	virtual float get_stream_sampling_rate();
 
 	GDVIRTUAL2R_REQUIRED(int, _mix_resampled, GDExtensionPtr<AudioFrame>, int)
@@ -153,6 +162,7 @@ protected:
 
 public:
 	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override;
+	virtual int skip(float p_rate_scale, int p_frames) override;
 
 	AudioStreamPlaybackResampled() { mix_offset = 0; }
 };
@@ -179,6 +179,7 @@ float AudioEffectCompressor::get_mix() const {
 void AudioEffectCompressor::set_sidechain(const StringName &p_sidechain) {
 	AudioServer::get_singleton()->lock();
 	sidechain = p_sidechain;
+	AudioServer::get_singleton()->bus_schedule_dirty.set();
 	AudioServer::get_singleton()->unlock();
 }
 
@@ -40,12 +40,14 @@
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
+#include "core/templates/sort_array.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio/audio_stream.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
+#include <thread>
 
 #ifdef TOOLS_ENABLED
 #define MARK_EDITED set_edited(true);
@@ -376,6 +378,10 @@ void AudioServer::_mix_step() {
 			bus->soloed = false;
 		}
 	}
+	bus_solo_mode = solo_mode;
+
+	_update_voice_audibility();
+
 	// This is legacy code from 3.x that allows video players and other audio sources that do not implement AudioStreamPlayback to output audio.
 	for (CallbackItem *ci : mix_callback_list) {
 		ci->callback(ci->userdata);
@@ -394,10 +400,43 @@ void AudioServer::_mix_step() {
 			continue;
 		}
 
+		if (playback->virtualized) {
+			switch (playback->state.load()) {
+				case AudioStreamPlaybackListNode::AWAITING_DELETION:
+				case AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION:
+					// Already silent, no need to fade out.
+					_delete_stream_playback_list_node(playback);
+					continue;
+				case AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE:
+					playback->state.store(AudioStreamPlaybackListNode::PAUSED);
+					continue;
+				default:
+					break;
+			}
+
+			if (!playback->audible) {
+				// Keep the playback position moving without decoding or mixing anything.
+				unsigned int skipped_frames = playback->stream_playback->skip(playback->pitch_scale.get(), buffer_size);
+				if (tag_used_audio_streams && playback->stream_playback->is_playing()) {
+					playback->stream_playback->tag_used_streams();
+				}
+				if (skipped_frames != buffer_size) {
+					_delete_stream_playback_list_node(playback);
+				}
+				continue;
+			}
+
+			// Audible again. The previous volumes were faded out to silence when virtualizing, so this fades back in.
+			playback->virtualized = false;
+		}
+
+		// Voices becoming virtual fade out over this mix step, like stopped voices.
+		bool virtualizing = !playback->audible;
+
 		// If `fading_out` is true, we're in the process of fading out the stream playback.
 		// TODO: Currently this sets the volume of the stream to 0 which creates a linear interpolation between its previous volume and silence.
 		//  A more punchy option for fading out could be to just use the lookahead buffer.
-		bool fading_out = playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
+		bool fading_out = virtualizing || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_DELETION || playback->state.load() == AudioStreamPlaybackListNode::FADE_OUT_TO_PAUSE;
 
 		AudioFrame *buf = mix_buffer.ptrw();
 
@@ -532,6 +571,14 @@ void AudioServer::_mix_step() {
 				playback->state.store(AudioStreamPlaybackListNode::PAUSED);
 			} break;
 			case AudioStreamPlaybackListNode::PLAYING:
+				if (virtualizing) {
+					// The lookahead won't match the position the stream resumes from.
+					for (AudioFrame &frame : playback->lookahead) {
+						frame = AudioFrame(0, 0);
+					}
+					playback->virtualized = true;
+				}
+				break;
 			case AudioStreamPlaybackListNode::PAUSED:
 				// No-op!
 				break;
@@ -539,133 +586,374 @@ void AudioServer::_mix_step() {
 	}
 
 	// Now that all of the buses have their audio sources mixed into them, we can process the effects and bus sends.
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		Bus *bus = buses[i];
+	int bus_count = buses.size();
+	if (bus_schedule_dirty.is_set() || (int)bus_levels.size() != bus_count) {
+		bus_schedule_dirty.clear();
+		_update_bus_schedule();
+	}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				// Buffer was not used, but it's still active, so it must be cleaned.
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	if (bus_threads.is_empty()) {
+		// Go bus by bus, from the last one to the master.
+		for (int i = bus_count - 1; i >= 0; i--) {
+			_mix_step_bus_effects(i);
+			_mix_step_bus_send(i, bus_sends[i]);
+		}
+	} else {
+		for (int level = 0; level <= bus_max_level; level++) {
+			bus_jobs.clear();
+			for (int i = bus_count - 1; i >= 0; i--) {
+				if (bus_levels[i] == level && !bus_serial[i]) {
+					bus_jobs.push_back(i);
+				}
+			}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
+			if (bus_jobs.size() > 1) {
+				// Hand the buses of this level over to the bus threads and help processing them.
+				bus_job_base = bus_job_end.load(std::memory_order_relaxed);
+				uint64_t level_end = bus_job_base + bus_jobs.size();
+				bus_job_end.store(level_end, std::memory_order_release);
+				bus_threads_semaphore.post(MIN(bus_jobs.size() - 1, bus_threads.size()));
+				while (_process_next_bus_job()) {
+				}
+				while (bus_job_done.load(std::memory_order_acquire) < level_end) {
+					std::this_thread::yield();
+				}
+			} else {
+				for (int bus_index : bus_jobs) {
+					_mix_step_bus_effects(bus_index);
 				}
 			}
-		}
 
-		// Process effects.
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
+			for (int i = bus_count - 1; i >= 0; i--) {
+				if (bus_levels[i] == level && bus_serial[i]) {
+					_mix_step_bus_effects(i);
+				}
+			}
+
+			for (int i = bus_count - 1; i >= 0; i--) {
+				if (bus_levels[i] == level) {
+					_mix_step_bus_send(i, bus_sends[i]);
 				}
+			}
+		}
+	}
+
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
+
+float AudioServer::_get_playback_audibility(AudioStreamPlaybackListNode *p_playback_node) const {
+	const AudioStreamPlaybackBusDetails *bus_details = p_playback_node->bus_details.load();
+	if (!bus_details) {
+		return 0.0;
+	}
+
+	float audibility = 0.0;
+	for (int idx = 0; idx < MAX_BUSES_PER_PLAYBACK; idx++) {
+		if (!bus_details->bus_active[idx]) {
+			continue;
+		}
+		for (int channel_idx = 0; channel_idx < channel_count; channel_idx++) {
+			const AudioFrame &volume = bus_details->volume[idx][channel_idx];
+			audibility = MAX(audibility, MAX(Math::abs(volume.left), Math::abs(volume.right)));
+		}
+	}
+	return audibility;
+}
+
+void AudioServer::_update_voice_audibility() {
+	SortArray<VoiceCandidate, VoiceCandidateCompare> heap;
+	uint32_t heap_size = 0;
+
+	for (AudioStreamPlaybackListNode *playback : playback_list) {
+		playback->audible = true;
+		if (playback->state.load() != AudioStreamPlaybackListNode::PLAYING || playback->stream_playback->get_is_sample()) {
+			continue;
+		}
+
+		float audibility = _get_playback_audibility(playback);
+		if (audibility <= (playback->virtualized ? voice_revive_threshold : voice_virtualize_threshold)) {
+			playback->audible = false;
+			continue;
+		}
+
+		if (max_voices <= 0) {
+			continue;
+		}
+
+		// Keep the best `max_voices` voices, the worst of them at the top of the heap.
+		// Voices that are being mixed get a head start, so voices of similar volume don't swap places every mix step.
+		VoiceCandidate candidate;
+		candidate.playback = playback;
+		candidate.priority = playback->priority.get();
+		candidate.audibility = playback->virtualized ? audibility : audibility * voice_budget_margin;
+
+		if (heap_size < (uint32_t)max_voices) {
+			heap.push_heap(0, heap_size, 0, candidate, voice_heap.ptr());
+			heap_size++;
+		} else if (heap.compare(candidate, voice_heap[0])) {
+			voice_heap[0].playback->audible = false;
+			heap.adjust_heap(0, 0, heap_size, candidate, voice_heap.ptr());
+		} else {
+			playback->audible = false;
+		}
+	}
+}
+
+void AudioServer::_mix_step_bus_effects(int p_bus) {
+	Bus *bus = buses[p_bus];
+
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			// Buffer was not used, but it's still active, so it must be cleaned.
+			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+
+			for (uint32_t j = 0; j < buffer_size; j++) {
+				buf[j] = AudioFrame(0, 0);
+			}
+		}
+	}
+
+	// Process effects.
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
+			}
 
 #ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
 #endif
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
-
+				Bus::Channel &channel = bus->channels.write[k];
+				channel.effect_instances.write[j]->process(channel.buffer.ptr(), channel.effect_buffer.ptrw(), buffer_size);
 				// Swap buffers, so internal buffer always has the right data.
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
-				}
+				SWAP(channel.buffer, channel.effect_buffer);
+			}
 
 #ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
 #endif
-			}
 		}
+	}
 
-		// Process send.
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-		Bus *send = nullptr;
+		AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
 
-		if (i > 0) {
-			// Everything has a send except for the master bus.
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { // Invalid, send to master.
-					send = buses[0];
-				}
+		AudioFrame peak = AudioFrame(0, 0);
+
+		float volume = Math::db_to_linear(bus->volume_db);
+
+		if (bus_solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
+			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
 			}
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
-				continue;
-			}
+		// Apply volume and compute peak.
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			buf[j] *= volume;
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+			float l = Math::abs(buf[j].left);
+			if (l > peak.left) {
+				peak.left = l;
+			}
+			float r = Math::abs(buf[j].right);
+			if (r > peak.right) {
+				peak.right = r;
+			}
+		}
 
-			AudioFrame peak = AudioFrame(0, 0);
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
 
-			float volume = Math::db_to_linear(bus->volume_db);
+		if (!bus->channels[k].used) {
+			// See if any audio is contained, because channel was not used.
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false; // Went inactive, don't mix.
 			}
+		}
+	}
+}
 
-			// Apply volume and compute peak.
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+void AudioServer::_mix_step_bus_send(int p_bus, int p_send) {
+	if (p_send < 0) {
+		return; // Master bus.
+	}
 
-				float l = Math::abs(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
+	Bus *bus = buses[p_bus];
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			continue;
+		}
+
+		const AudioFrame *buf = bus->channels[k].buffer.ptr();
+		AudioFrame *target_buf = thread_get_channel_mix_buffer(p_send, k);
+
+		for (uint32_t j = 0; j < buffer_size; j++) {
+			target_buf[j] += buf[j];
+		}
+	}
+}
+
+void AudioServer::_reserve_bus_processing_data() {
+	uint32_t bus_count = buses.size();
+	bus_jobs.reserve(bus_count);
+	bus_sends.reserve(bus_count);
+	bus_levels.reserve(bus_count);
+	bus_serial.reserve(bus_count);
+}
+
+// Finds the level of each bus in the graph of sends: a bus can only be processed once all the buses sending to it are done.
+// Buses on the same level don't depend on each other. Buses using a compressor sidechain are kept on the audio thread and
+// see the sidechain bus in the same state as when processing the buses one by one: fully processed if it comes after them,
+// not processed yet if it comes before them.
+void AudioServer::_update_bus_schedule() {
+	int bus_count = buses.size();
+	bus_sends.resize(bus_count);
+	bus_levels.resize(bus_count);
+	bus_serial.resize(bus_count);
+	for (int i = 0; i < bus_count; i++) {
+		bus_levels[i] = 0;
+	}
+
+	// Levels are only raised for the current bus by the buses after it, or for the buses before it.
+	// So the level of a bus is final once the loop reaches it.
+	bus_max_level = 0;
+	for (int i = bus_count - 1; i >= 0; i--) {
+		Bus *bus = buses[i];
+
+		int send = -1;
+		if (i > 0) {
+			// Everything has a send except for the master bus.
+			Bus **send_bus = bus_map.getptr(bus->send);
+			send = send_bus ? (*send_bus)->index_cache : 0;
+			if (send >= i) { // Invalid, send to master.
+				send = 0;
+			}
+		}
+
+		bool serial = false;
+		if (!bus->bypass) {
+			for (int j = 0; j < bus->effects.size(); j++) {
+				AudioEffectCompressor *compressor = Object::cast_to<AudioEffectCompressor>(bus->effects[j].effect.ptr());
+				if (!bus->effects[j].enabled || !compressor || compressor->get_sidechain() == StringName()) {
+					continue;
 				}
-				float r = Math::abs(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
+				serial = true;
+				int sidechain = thread_find_bus_index(compressor->get_sidechain());
+				if (sidechain > i) {
+					bus_levels[i] = MAX(bus_levels[i], bus_levels[sidechain] + 1);
+				} else if (sidechain < i) {
+					bus_levels[sidechain] = MAX(bus_levels[sidechain], bus_levels[i] + 1);
 				}
 			}
+		}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+		bus_sends[i] = send;
+		bus_serial[i] = serial;
+		if (send >= 0) {
+			bus_levels[send] = MAX(bus_levels[send], bus_levels[i] + 1);
+		}
+		bus_max_level = MAX(bus_max_level, bus_levels[i]);
+	}
+}
 
-			if (!bus->channels[k].used) {
-				// See if any audio is contained, because channel was not used.
+void AudioServer::_start_bus_threads(int p_count) {
+	bus_threads_exit.clear();
+	Thread::Settings settings;
+	settings.priority = Thread::PRIORITY_HIGH;
+	for (int i = 0; i < p_count; i++) {
+		Thread *thread = memnew(Thread);
+		thread->start(&AudioServer::_bus_thread_func, this, settings);
+		bus_threads.push_back(thread);
+	}
+}
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
-			}
+void AudioServer::_stop_bus_threads() {
+	if (bus_threads.is_empty()) {
+		return;
+	}
+	bus_threads_exit.set();
+	bus_threads_semaphore.post(bus_threads.size());
+	for (Thread *thread : bus_threads) {
+		thread->wait_to_finish();
+		memdelete(thread);
+	}
+	bus_threads.clear();
+}
 
-			if (send) {
-				// If not master bus, send.
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+void AudioServer::_bus_thread_func(void *p_userdata) {
+	AudioServer *audio_server = static_cast<AudioServer *>(p_userdata);
+	while (true) {
+		audio_server->bus_threads_semaphore.wait();
+		if (audio_server->bus_threads_exit.is_set()) {
+			return;
+		}
+		while (audio_server->_process_next_bus_job()) {
+		}
+	}
+}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
-			}
+bool AudioServer::_process_next_bus_job() {
+	uint64_t job = bus_job_next.load(std::memory_order_relaxed);
+	do {
+		if (job >= bus_job_end.load(std::memory_order_acquire)) {
+			return false;
 		}
+	} while (!bus_job_next.compare_exchange_weak(job, job + 1, std::memory_order_acq_rel));
+
+	_mix_step_bus_effects(bus_jobs[job - bus_job_base]);
+	bus_job_done.fetch_add(1, std::memory_order_release);
+	return true;
+}
+
+// Mixing kernels. Source and destination never overlap and both channels are computed in the same loop,
+// so the compiler can vectorize these. Volume ramps are computed from the frame index rather than accumulated,
+// which keeps iterations independent.
+
+static void _mix_frames(AudioFrame *__restrict p_out, const AudioFrame *__restrict p_src, uint32_t p_frames, AudioFrame p_vol) {
+	for (uint32_t i = 0; i < p_frames; i++) {
+		p_out[i].left += p_src[i].left * p_vol.left;
+		p_out[i].right += p_src[i].right * p_vol.right;
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+static void _mix_frames_ramp(AudioFrame *__restrict p_out, const AudioFrame *__restrict p_src, uint32_t p_frames, AudioFrame p_vol_start, AudioFrame p_vol_step) {
+	for (uint32_t i = 0; i < p_frames; i++) {
+		float idx = i;
+		p_out[i].left += p_src[i].left * (p_vol_start.left + p_vol_step.left * idx);
+		p_out[i].right += p_src[i].right * (p_vol_start.right + p_vol_step.right * idx);
+	}
+}
+
+static void _scale_frames_ramp(AudioFrame *__restrict p_out, const AudioFrame *__restrict p_src, uint32_t p_frames, AudioFrame p_vol_start, AudioFrame p_vol_step) {
+	for (uint32_t i = 0; i < p_frames; i++) {
+		float idx = i;
+		p_out[i].left = p_src[i].left * (p_vol_start.left + p_vol_step.left * idx);
+		p_out[i].right = p_src[i].right * (p_vol_start.right + p_vol_step.right * idx);
+	}
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
+	// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
+	AudioFrame vol_step = (p_vol_final - p_vol_start) / float(buffer_size);
+
 	// TODO: In the future it could be nice to replace all of these hardcoded effects with something a bit cleaner and more flexible, but for now this is what we do to support 3D audio players.
 	if (p_highshelf_gain != 0) {
 		AudioFilterSW filter;
@@ -685,22 +973,17 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
-			AudioFrame mixed = vol * p_source_buf[frame_idx];
-			p_processor_l->process_one_interp(mixed.left);
-			p_processor_r->process_one_interp(mixed.right);
-			p_out_buf[frame_idx] += mixed;
-		}
+		// Apply the volume, filter each channel on its own, then mix. The filter is recursive, so only the first and last steps vectorize.
+		AudioFrame *filter_buf = filter_buffer.ptrw();
+		_scale_frames_ramp(filter_buf, p_source_buf, buffer_size, p_vol_start, vol_step);
+		p_processor_l->process(&filter_buf[0].left, buffer_size, 2, true);
+		p_processor_r->process(&filter_buf[0].right, buffer_size, 2, true);
+		_mix_frames(p_out_buf, filter_buf, buffer_size, AudioFrame(1, 1));
 
+	} else if (p_vol_start.left == p_vol_final.left && p_vol_start.right == p_vol_final.right) {
+		_mix_frames(p_out_buf, p_source_buf, buffer_size, p_vol_final);
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// TODO: Make lerp speed buffer-size-invariant if buffer_size ever becomes a project setting to avoid very small buffer sizes causing pops due to too-fast lerps.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		_mix_frames_ramp(p_out_buf, p_source_buf, buffer_size, p_vol_start, vol_step);
 	}
 }
 
@@ -823,6 +1106,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -836,6 +1120,9 @@ void AudioServer::set_bus_count(int p_count) {
 		bus_map[attempt] = buses[i];
 	}
 
+	_reserve_bus_processing_data();
+	bus_schedule_dirty.set();
+
 	unlock();
 
 	AudioDriver::get_singleton()->set_sample_bus_count(p_count);
@@ -853,6 +1140,7 @@ void AudioServer::remove_bus(int p_index) {
 	bus_map.erase(buses[p_index]->name);
 	memdelete(buses[p_index]);
 	buses.remove_at(p_index);
+	bus_schedule_dirty.set();
 	unlock();
 
 	AudioDriver::get_singleton()->remove_sample_bus(p_index);
@@ -896,6 +1184,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -903,6 +1192,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->bypass = false;
 	bus->volume_db = 0;
 
+	lock();
 	bus_map[attempt] = bus;
 
 	if (p_at_pos == -1) {
@@ -910,6 +1200,9 @@ void AudioServer::add_bus(int p_at_pos) {
 	} else {
 		buses.insert(p_at_pos, bus);
 	}
+	_reserve_bus_processing_data();
+	bus_schedule_dirty.set();
+	unlock();
 
 	AudioDriver::get_singleton()->add_sample_bus(p_at_pos);
 
@@ -936,6 +1229,7 @@ void AudioServer::move_bus(int p_bus, int p_to_pos) {
 	} else {
 		buses.insert(p_to_pos - 1, bus);
 	}
+	bus_schedule_dirty.set();
 
 	AudioDriver::get_singleton()->move_sample_bus(p_bus, p_to_pos);
 
@@ -985,6 +1279,7 @@ void AudioServer::set_bus_name(int p_bus, const String &p_name) {
 	bus_map.erase(old_name);
 	buses[p_bus]->name = attempt;
 	bus_map[attempt] = buses[p_bus];
+	bus_schedule_dirty.set();
 	unlock();
 
 	emit_signal(SNAME("bus_renamed"), p_bus, old_name, attempt);
@@ -1038,6 +1333,7 @@ void AudioServer::set_bus_send(int p_bus, const StringName &p_send) {
 	MARK_EDITED
 
 	buses[p_bus]->send = p_send;
+	bus_schedule_dirty.set();
 
 	AudioDriver::get_singleton()->set_sample_bus_send(p_bus, p_send);
 }
@@ -1085,6 +1381,7 @@ void AudioServer::set_bus_bypass_effects(int p_bus, bool p_enable) {
 	MARK_EDITED
 
 	buses[p_bus]->bypass = p_enable;
+	bus_schedule_dirty.set();
 }
 
 bool AudioServer::is_bus_bypassing_effects(int p_bus) const {
@@ -1129,6 +1426,7 @@ void AudioServer::add_bus_effect(int p_bus, const Ref<AudioEffect> &p_effect, in
 	}
 
 	_update_bus_effects(p_bus);
+	bus_schedule_dirty.set();
 
 	unlock();
 }
@@ -1142,6 +1440,7 @@ void AudioServer::remove_bus_effect(int p_bus, int p_effect) {
 
 	buses[p_bus]->effects.remove_at(p_effect);
 	_update_bus_effects(p_bus);
+	bus_schedule_dirty.set();
 
 	unlock();
 }
@@ -1177,6 +1476,7 @@ void AudioServer::swap_bus_effects(int p_bus, int p_effect, int p_by_effect) {
 	lock();
 	SWAP(buses.write[p_bus]->effects.write[p_effect], buses.write[p_bus]->effects.write[p_by_effect]);
 	_update_bus_effects(p_bus);
+	bus_schedule_dirty.set();
 	unlock();
 }
 
@@ -1187,6 +1487,7 @@ void AudioServer::set_bus_effect_enabled(int p_bus, int p_effect, bool p_enabled
 	MARK_EDITED
 
 	buses.write[p_bus]->effects.write[p_effect].enabled = p_enabled;
+	bus_schedule_dirty.set();
 }
 
 bool AudioServer::is_bus_effect_enabled(int p_bus, int p_effect) const {
@@ -1418,6 +1719,17 @@ void AudioServer::set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool
 	} while (!playback_node->state.compare_exchange_strong(old_state, new_state));
 }
 
+void AudioServer::set_playback_priority(Ref<AudioStreamPlayback> p_playback, int p_priority) {
+	ERR_FAIL_COND(p_playback.is_null());
+
+	AudioStreamPlaybackListNode *playback_node = _find_playback_list_node(p_playback);
+	if (!playback_node) {
+		return;
+	}
+
+	playback_node->priority.set(p_priority);
+}
+
 void AudioServer::set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz) {
 	ERR_FAIL_COND(p_playback.is_null());
 
@@ -1497,17 +1809,14 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
-
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
+	filter_buffer.resize(buffer_size);
 
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1526,6 +1835,18 @@ void AudioServer::init() {
 	set_bus_count(1);
 	set_bus_name(0, "Master");
 
+	max_voices = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/general/max_voices", PropertyHint::HINT_RANGE, "0,1024,1,or_greater"), 0);
+	voice_heap.resize(MAX(max_voices, 0));
+	float voice_virtualization_threshold_db = GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/general/voice_virtualization_threshold_db", PropertyHint::HINT_RANGE, "-120,0,0.1,suffix:dB"), -80.0);
+	voice_virtualize_threshold = Math::db_to_linear(voice_virtualization_threshold_db);
+	voice_revive_threshold = Math::db_to_linear(voice_virtualization_threshold_db + VOICE_HYSTERESIS_DB);
+	voice_budget_margin = Math::db_to_linear(VOICE_HYSTERESIS_DB);
+
+	int bus_thread_count = GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "audio/buses/effect_processing_threads", PropertyHint::HINT_RANGE, "0,16,1"), 0);
+	if (bus_thread_count > 0) {
+		_start_bus_threads(bus_thread_count);
+	}
+
 	if (AudioDriver::get_singleton()) {
 		AudioDriver::get_singleton()->start();
 		AudioDriver::get_singleton()->set_sample_bus_count(1);
@@ -1640,6 +1961,8 @@ void AudioServer::finish() {
 		AudioDriverManager::get_driver(i)->finish();
 	}
 
+	_stop_bus_threads();
+
 	for (int i = 0; i < buses.size(); i++) {
 		memdelete(buses[i]);
 	}
@@ -1787,9 +2110,12 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
+	_reserve_bus_processing_data();
+	bus_schedule_dirty.set();
 #ifdef TOOLS_ENABLED
 	set_edited(false);
 #endif
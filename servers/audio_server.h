@@ -35,6 +35,8 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/os/semaphore.h"
+#include "core/os/thread.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -248,6 +250,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Output of the effect being processed, swapped with buffer afterwards.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -296,6 +299,7 @@ private:
 		SafeNumeric<float> pitch_scale;
 		SafeNumeric<float> highshelf_gain;
 		SafeNumeric<float> attenuation_filter_cutoff_hz; // This isn't used unless highshelf_gain is nonzero.
+		SafeNumeric<int> priority;
 		AudioFilterSW::Processor filter_process[8];
 		// Updating this ref after the list node is created breaks consistency guarantees, don't do it!
 		Ref<AudioStreamPlayback> stream_playback;
@@ -307,9 +311,38 @@ private:
 		AudioStreamPlaybackBusDetails *prev_bus_details = nullptr;
 		// The next few samples are stored here so we have some time to fade audio out if it ends abruptly at the beginning of the next mix.
 		AudioFrame lookahead[LOOKAHEAD_BUFFER_SIZE];
+		// Virtual voices are skipped instead of being mixed. Only accessed on the audio thread.
+		bool virtualized = false;
+		bool audible = true; // Whether the voice should be mixed in the current mix step.
 	};
 
 	SafeList<AudioStreamPlaybackListNode *> playback_list;
+
+	/* Voice virtualization */
+	// Voices below the threshold or beyond the voice budget keep playing without being decoded or mixed.
+	struct VoiceCandidate {
+		AudioStreamPlaybackListNode *playback = nullptr;
+		int priority = 0;
+		float audibility = 0.0;
+	};
+	struct VoiceCandidateCompare {
+		// Sorts the best voices first, so the voice heap keeps the worst selected voice on top.
+		_FORCE_INLINE_ bool operator()(const VoiceCandidate &p_a, const VoiceCandidate &p_b) const {
+			if (p_a.priority != p_b.priority) {
+				return p_a.priority > p_b.priority;
+			}
+			return p_a.audibility > p_b.audibility;
+		}
+	};
+	static constexpr float VOICE_HYSTERESIS_DB = 3.0;
+	int max_voices = 0;
+	float voice_virtualize_threshold = 0.0;
+	float voice_revive_threshold = 0.0; // Slightly higher than the virtualization threshold to avoid toggling every mix step.
+	float voice_budget_margin = 1.0; // Volume factor favoring the voices already mixed when selecting the voice budget, for the same reason.
+	LocalVector<VoiceCandidate> voice_heap;
+
+	float _get_playback_audibility(AudioStreamPlaybackListNode *p_playback_node) const;
+	void _update_voice_audibility();
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard;
 	void _delete_stream_playback(Ref<AudioStreamPlayback> p_playback);
 	void _delete_stream_playback_list_node(AudioStreamPlaybackListNode *p_node);
@@ -317,18 +350,49 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
+	Vector<AudioFrame> filter_buffer; // Scratch buffer for the attenuation filter of 3D players.
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
 	void _update_bus_effects(int p_bus);
 
+	/* Bus effect processing threads */
+	// Buses only send to buses with a lower index, so the bus graph is a DAG. It is processed level by level,
+	// the effects of the buses of a level being independent from each other they can run on the bus threads.
+	LocalVector<Thread *> bus_threads;
+	Semaphore bus_threads_semaphore;
+	SafeFlag bus_threads_exit;
+
+	// Jobs are claimed lock-free. The counters never go back so a late worker can't claim a job twice.
+	std::atomic<uint64_t> bus_job_next = 0;
+	std::atomic<uint64_t> bus_job_end = 0;
+	std::atomic<uint64_t> bus_job_done = 0;
+	uint64_t bus_job_base = 0;
+	LocalVector<int> bus_jobs;
+
+	// Per bus, rebuilt on the audio thread when the bus graph changed. Reserved on the main thread so the audio thread never allocates.
+	LocalVector<int> bus_sends;
+	LocalVector<int> bus_levels;
+	LocalVector<uint8_t> bus_serial;
+	int bus_max_level = 0;
+	SafeFlag bus_schedule_dirty;
+	bool bus_solo_mode = false;
+
+	void _reserve_bus_processing_data();
+	void _update_bus_schedule();
+	void _start_bus_threads(int p_count);
+	void _stop_bus_threads();
+	static void _bus_thread_func(void *p_userdata);
+	bool _process_next_bus_job();
+
 	static AudioServer *singleton;
 
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _mix_step_bus_effects(int p_bus);
+	void _mix_step_bus_send(int p_bus, int p_send);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -344,6 +408,8 @@ private:
 	SafeList<CallbackItem *> listener_changed_callback_list;
 
 	friend class AudioDriver;
+	friend class AudioEffectCompressor;
+	friend class TestAudioServerInternalsAccessor;
 	void _driver_process(int p_frames, int32_t *p_buffer);
 
 	LocalVector<Ref<AudioSamplePlayback>> sample_playback_list;
@@ -441,6 +507,7 @@ public:
 	void set_playback_pitch_scale(Ref<AudioStreamPlayback> p_playback, float p_pitch_scale);
 	void set_playback_paused(Ref<AudioStreamPlayback> p_playback, bool p_paused);
 	void set_playback_highshelf_params(Ref<AudioStreamPlayback> p_playback, float p_gain, float p_attenuation_cutoff_hz);
+	void set_playback_priority(Ref<AudioStreamPlayback> p_playback, int p_priority);
 
 	bool is_playback_active(Ref<AudioStreamPlayback> p_playback);
 	float get_playback_position(Ref<AudioStreamPlayback> p_playback);
@@ -103,6 +103,7 @@ public:
 	virtual Variant shader_get_parameter_default(RID p_material, const StringName &p_param) const override { return Variant(); }
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override { return RS::ShaderNativeSourceCode(); }
+	virtual uint32_t shader_precompile_variants() override { return 0; }
 
 	/* MATERIAL API */
 
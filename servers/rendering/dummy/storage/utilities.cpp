@@ -64,6 +64,9 @@ bool Utilities::free(RID p_rid) {
 	} else if (RendererDummy::MeshStorage::get_singleton()->owns_multimesh(p_rid)) {
 		RendererDummy::MeshStorage::get_singleton()->multimesh_free(p_rid);
 		return true;
+	} else if (RendererDummy::MeshStorage::get_singleton()->owns_skeleton(p_rid)) {
+		RendererDummy::MeshStorage::get_singleton()->skeleton_free(p_rid);
+		return true;
 	} else if (RendererDummy::MaterialStorage::get_singleton()->owns_shader(p_rid)) {
 		RendererDummy::MaterialStorage::get_singleton()->shader_free(p_rid);
 		return true;
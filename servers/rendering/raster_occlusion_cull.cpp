@@ -0,0 +1,479 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
+RasterOcclusionCull *RasterOcclusionCull::raster_singleton = nullptr;
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(float p_depth_range) {
+	if (is_empty()) {
+		return;
+	}
+
+	debug_tex_range = p_depth_range;
+
+	// Rows are split in bands, so each thread writes to its own part of the buffer.
+	RasterThreadData td;
+	td.triangles = triangles.ptr();
+	td.triangle_count = triangles.size();
+	td.band_count = MIN((uint32_t)sizes[0].y, WorkerThreadPool::get_singleton()->get_thread_count() * 4);
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_band_threaded, &td, td.band_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	update_mips();
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_band_threaded(uint32_t p_band, const RasterThreadData *p_data) {
+	const int height = sizes[0].y;
+	const int width = sizes[0].x;
+	const int from_y = p_band * height / p_data->band_count;
+	const int to_y = (p_band + 1 == p_data->band_count) ? height : ((p_band + 1) * height / p_data->band_count);
+
+	float *band = &mips[0][from_y * width];
+	for (int i = 0; i < (to_y - from_y) * width; i++) {
+		band[i] = FLT_MAX;
+	}
+
+	for (uint32_t i = 0; i < p_data->triangle_count; i++) {
+		const Triangle &triangle = p_data->triangles[i];
+		if (triangle.max_y < from_y || triangle.min_y >= to_y) {
+			continue;
+		}
+		_rasterize_triangle(triangle, MAX(from_y, triangle.min_y), MIN(to_y - 1, triangle.max_y));
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_triangle(const Triangle &p_triangle, int p_from_y, int p_to_y) {
+	const Vector2 &a = p_triangle.points[0];
+	const Vector2 &b = p_triangle.points[1];
+	const Vector2 &c = p_triangle.points[2];
+
+	const float area = (b - a).cross(c - a);
+	if (Math::is_zero_approx(area)) {
+		return;
+	}
+
+	const int width = sizes[0].x;
+	const float min_x = MIN(a.x, MIN(b.x, c.x));
+	const float max_x = MAX(a.x, MAX(b.x, c.x));
+	const int from_x = MAX(0, (int)Math::ceil(min_x - 0.5f));
+	const int to_x = MIN(width - 1, (int)Math::floor(max_x - 0.5f));
+	if (from_x > to_x) {
+		return;
+	}
+
+	// Edge functions, flipped so they are positive inside for both windings.
+	// Occluders are double-sided, like in the raycast backend.
+	const float edge_sign = area > 0.0f ? 1.0f : -1.0f;
+	float edge_a[3];
+	float edge_b[3];
+	float edge_c[3];
+	for (int i = 0; i < 3; i++) {
+		const Vector2 &from = p_triangle.points[i];
+		const Vector2 &to = p_triangle.points[(i + 1) % 3];
+		edge_a[i] = -(to.y - from.y) * edge_sign;
+		edge_b[i] = (to.x - from.x) * edge_sign;
+		edge_c[i] = -(edge_a[i] * from.x + edge_b[i] * from.y);
+	}
+
+	// Screen-space gradients of depth / w and 1 / w, so depth is perspective correct at each pixel center.
+	const float *zw = p_triangle.depth_over_w;
+	const float *iw = p_triangle.inv_w;
+	const float zw_dx = ((zw[1] - zw[0]) * (c.y - a.y) - (zw[2] - zw[0]) * (b.y - a.y)) / area;
+	const float zw_dy = ((zw[2] - zw[0]) * (b.x - a.x) - (zw[1] - zw[0]) * (c.x - a.x)) / area;
+	const float iw_dx = ((iw[1] - iw[0]) * (c.y - a.y) - (iw[2] - iw[0]) * (b.y - a.y)) / area;
+	const float iw_dy = ((iw[2] - iw[0]) * (b.x - a.x) - (iw[1] - iw[0]) * (c.x - a.x)) / area;
+
+	const float start_x = from_x + 0.5f;
+	const int span = to_x - from_x + 1;
+
+	for (int y = p_from_y; y <= p_to_y; y++) {
+		const float py = y + 0.5f;
+		const float e0 = edge_a[0] * start_x + edge_b[0] * py + edge_c[0];
+		const float e1 = edge_a[1] * start_x + edge_b[1] * py + edge_c[1];
+		const float e2 = edge_a[2] * start_x + edge_b[2] * py + edge_c[2];
+		const float row_zw = zw[0] + zw_dx * (start_x - a.x) + zw_dy * (py - a.y);
+		const float row_iw = iw[0] + iw_dx * (start_x - a.x) + iw_dy * (py - a.y);
+
+		float *row = &mips[0][y * width + from_x];
+
+		// No dependencies between pixels, so this loop vectorizes.
+		for (int i = 0; i < span; i++) {
+			const float fi = float(i);
+			const float inside = MIN(e0 + edge_a[0] * fi, MIN(e1 + edge_a[1] * fi, e2 + edge_a[2] * fi));
+			const float depth = (row_zw + zw_dx * fi) / (row_iw + iw_dx * fi);
+			row[i] = (inside >= 0.0f && depth < row[i]) ? depth : row[i];
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	for (const InstanceID &E : occluder->users) {
+		Scenario *scenario = scenarios.getptr(E.scenario);
+		ERR_CONTINUE(!scenario);
+		OccluderInstance *instance = scenario->instances.getptr(E.instance);
+		ERR_CONTINUE(!instance);
+		instance->dirty = true;
+	}
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	// Instances still using it stop occluding on the next update.
+	for (const InstanceID &E : occluder->users) {
+		Scenario *scenario = scenarios.getptr(E.scenario);
+		ERR_CONTINUE(!scenario);
+		OccluderInstance *instance = scenario->instances.getptr(E.instance);
+		ERR_CONTINUE(!instance);
+		instance->dirty = true;
+	}
+
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		Occluder *occluder = occluder_owner.get_or_null(E.value.occluder);
+		if (occluder) {
+			occluder->users.erase(InstanceID(p_scenario, E.key));
+		}
+	}
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	OccluderInstance *instance = scenario->instances.getptr(p_instance);
+	if (!instance) {
+		instance = &scenario->instances.insert(p_instance, OccluderInstance())->value;
+	}
+
+	if (instance->occluder != p_occluder) {
+		Occluder *old_occluder = occluder_owner.get_or_null(instance->occluder);
+		if (old_occluder) {
+			old_occluder->users.erase(InstanceID(p_scenario, p_instance));
+		}
+
+		instance->occluder = p_occluder;
+
+		if (p_occluder.is_valid()) {
+			Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+			ERR_FAIL_NULL(occluder);
+			occluder->users.insert(InstanceID(p_scenario, p_instance));
+		}
+		instance->dirty = true;
+	}
+
+	if (instance->xform != p_xform) {
+		instance->xform = p_xform;
+		instance->dirty = true;
+	}
+
+	instance->enabled = p_enabled;
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	OccluderInstance *instance = scenario->instances.getptr(p_instance);
+	if (!instance) {
+		return;
+	}
+
+	Occluder *occluder = occluder_owner.get_or_null(instance->occluder);
+	if (occluder) {
+		occluder->users.erase(InstanceID(p_scenario, p_instance));
+	}
+	scenario->instances.erase(p_instance);
+}
+
+void RasterOcclusionCull::Scenario::update() {
+	for (KeyValue<RID, OccluderInstance> &E : instances) {
+		OccluderInstance &instance = E.value;
+		if (!instance.dirty) {
+			continue;
+		}
+		instance.dirty = false;
+
+		instance.xformed_vertices.clear();
+		instance.indices.clear();
+		instance.aabb = AABB();
+
+		const Occluder *occluder = raster_singleton->occluder_owner.get_or_null(instance.occluder);
+		if (!occluder || occluder->vertices.is_empty()) {
+			continue;
+		}
+
+		const int vertex_count = occluder->vertices.size();
+		const Vector3 *read = occluder->vertices.ptr();
+		instance.xformed_vertices.resize(vertex_count);
+		for (int i = 0; i < vertex_count; i++) {
+			instance.xformed_vertices[i] = instance.xform.xform(read[i]);
+			if (i == 0) {
+				instance.aabb.position = instance.xformed_vertices[i];
+			} else {
+				instance.aabb.expand_to(instance.xformed_vertices[i]);
+			}
+		}
+
+		// Drop incomplete triangles and out of range indices once here, so the per-frame setup doesn't need to check them.
+		const int32_t *indices = occluder->indices.ptr();
+		const int index_count = occluder->indices.size() - occluder->indices.size() % 3;
+		instance.indices.reserve(index_count);
+		for (int i = 0; i < index_count; i += 3) {
+			if (indices[i] < 0 || indices[i] >= vertex_count || indices[i + 1] < 0 || indices[i + 1] >= vertex_count || indices[i + 2] < 0 || indices[i + 2] >= vertex_count) {
+				continue;
+			}
+			instance.indices.push_back(indices[i]);
+			instance.indices.push_back(indices[i + 1]);
+			instance.indices.push_back(indices[i + 2]);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+Vector2 RasterOcclusionCull::_get_jitter() const {
+	if (!_jitter_enabled) {
+		return Vector2();
+	}
+
+	// Same pattern as RaycastOcclusionCull, expressed in buffer pixels.
+	static const Vector2 jitter_pattern[9] = {
+		Vector2(0, 0),
+		Vector2(-1, -1),
+		Vector2(1, -1),
+		Vector2(-1, 1),
+		Vector2(1, 1),
+		Vector2(-0.5f, -0.5f),
+		Vector2(0.5f, -0.5f),
+		Vector2(-0.5f, 0.5f),
+		Vector2(0.5f, 0.5f),
+	};
+
+	return jitter_pattern[Engine::get_singleton()->get_frames_drawn() % 9] * 0.33f;
+}
+
+void RasterOcclusionCull::_setup_triangles(const Scenario &p_scenario, RasterHZBuffer &r_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection) const {
+	r_buffer.triangles.clear();
+
+	const Size2i buffer_size = r_buffer.get_occlusion_buffer_size();
+	const Vector<Plane> planes = p_cam_projection.get_projection_planes(p_cam_transform);
+	const Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	const real_t z_near = p_cam_projection.get_z_near();
+	const Vector2 jitter = _get_jitter();
+
+	for (const KeyValue<RID, OccluderInstance> &E : p_scenario.instances) {
+		const OccluderInstance &instance = E.value;
+		if (!instance.enabled || instance.indices.is_empty()) {
+			continue;
+		}
+
+		bool outside = false;
+		for (const Plane &plane : planes) {
+			if (plane.distance_to(instance.aabb.get_support(-plane.normal)) > 0) {
+				outside = true;
+				break;
+			}
+		}
+		if (outside) {
+			continue;
+		}
+
+		for (uint32_t i = 0; i < instance.indices.size(); i += 3) {
+			Vector3 view[3];
+			for (int j = 0; j < 3; j++) {
+				view[j] = cam_inv_transform.xform(instance.xformed_vertices[instance.indices[i + j]]);
+			}
+
+			// Clip against the near plane, which leaves a polygon of up to 4 vertices.
+			Vector3 polygon[4];
+			int polygon_size = 0;
+			for (int j = 0; j < 3; j++) {
+				const Vector3 &current = view[j];
+				const Vector3 &next = view[(j + 1) % 3];
+				const bool current_in = current.z <= -z_near;
+				const bool next_in = next.z <= -z_near;
+				if (current_in) {
+					polygon[polygon_size++] = current;
+				}
+				if (current_in != next_in) {
+					polygon[polygon_size++] = current.lerp(next, (-z_near - current.z) / (next.z - current.z));
+				}
+			}
+			if (polygon_size < 3) {
+				continue;
+			}
+
+			Vector2 screen[4];
+			float depth_over_w[4];
+			float inv_w[4];
+			for (int j = 0; j < polygon_size; j++) {
+				const Plane projected = p_cam_projection.xform4(Plane(polygon[j], 1.0));
+				const real_t w = projected.d;
+				screen[j] = Vector2((projected.normal.x / w * 0.5f + 0.5f) * buffer_size.x, (projected.normal.y / w * 0.5f + 0.5f) * buffer_size.y) - jitter;
+				inv_w[j] = 1.0f / w;
+				depth_over_w[j] = -polygon[j].z / w;
+			}
+
+			for (int j = 1; j < polygon_size - 1; j++) {
+				const int corners[3] = { 0, j, j + 1 };
+
+				Triangle triangle;
+				real_t min_x = FLT_MAX;
+				real_t max_x = -FLT_MAX;
+				real_t min_y = FLT_MAX;
+				real_t max_y = -FLT_MAX;
+				for (int k = 0; k < 3; k++) {
+					triangle.points[k] = screen[corners[k]];
+					triangle.depth_over_w[k] = depth_over_w[corners[k]];
+					triangle.inv_w[k] = inv_w[corners[k]];
+					min_x = MIN(min_x, triangle.points[k].x);
+					max_x = MAX(max_x, triangle.points[k].x);
+					min_y = MIN(min_y, triangle.points[k].y);
+					max_y = MAX(max_y, triangle.points[k].y);
+				}
+
+				// Only pixel centers are sampled, skip triangles that don't cover any.
+				if (max_x < 0.5f || min_x > buffer_size.x - 0.5f || max_y < 0.5f || min_y > buffer_size.y - 0.5f) {
+					continue;
+				}
+				triangle.min_y = MAX(0, (int)Math::ceil(min_y - 0.5f));
+				triangle.max_y = MIN(buffer_size.y - 1, (int)Math::floor(max_y - 0.5f));
+				if (triangle.min_y > triangle.max_y) {
+					continue;
+				}
+
+				r_buffer.triangles.push_back(triangle);
+			}
+		}
+	}
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer) {
+		return;
+	}
+
+	Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (buffer->is_empty() || !scenario) {
+		return;
+	}
+
+	scenario->update();
+	_setup_triangles(*scenario, *buffer, p_cam_transform, p_cam_projection);
+	buffer->rasterize(p_cam_projection.get_z_far());
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+////////////////////////////////////////////////////////
+
+RasterOcclusionCull::RasterOcclusionCull() {
+	raster_singleton = this;
+	_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+}
+
+RasterOcclusionCull::~RasterOcclusionCull() {
+	raster_singleton = nullptr;
+}
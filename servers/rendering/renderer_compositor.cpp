@@ -33,6 +33,8 @@
 #include "renderer_compositor.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 
 #ifndef XR_DISABLED
 #include "servers/xr_server.h"
@@ -43,6 +45,38 @@ RendererCompositor *RendererCompositor::singleton = nullptr;
 RendererCompositor *(*RendererCompositor::_create_func)() = nullptr;
 bool RendererCompositor::low_end = false;
 
+void RendererCompositor::_seed_shader_cache_dir(const String &p_from, const String &p_to) {
+	Ref<DirAccess> da = DirAccess::open(p_from);
+	if (da.is_null()) {
+		return;
+	}
+
+	if (!DirAccess::dir_exists_absolute(p_to)) {
+		Error err = DirAccess::make_dir_recursive_absolute(p_to);
+		ERR_FAIL_COND_MSG(err != OK, "Can't create shader cache folder: " + p_to);
+	}
+
+	for (const String &dir : da->get_directories()) {
+		_seed_shader_cache_dir(p_from.path_join(dir), p_to.path_join(dir));
+	}
+
+	// Entries are named after a hash of the code they were compiled from, so existing ones are already up to date.
+	for (const String &file : da->get_files()) {
+		const String to = p_to.path_join(file);
+		if (!FileAccess::exists(to)) {
+			da->copy(p_from.path_join(file), to);
+		}
+	}
+}
+
+void RendererCompositor::seed_shader_cache(const String &p_shader_cache_dir) {
+	if (p_shader_cache_dir.is_empty() || !DirAccess::dir_exists_absolute(PRECOMPILED_SHADER_CACHE_PATH)) {
+		return;
+	}
+
+	_seed_shader_cache_dir(PRECOMPILED_SHADER_CACHE_PATH, p_shader_cache_dir);
+}
+
 RendererCompositor *RendererCompositor::create() {
 	return _create_func();
 }
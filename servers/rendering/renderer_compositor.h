@@ -75,7 +75,16 @@ protected:
 	bool back_end = false;
 	static bool low_end;
 
+	static void _seed_shader_cache_dir(const String &p_from, const String &p_to);
+
 public:
+	// Exports include shader caches precompiled with `--precompile-shaders <path>` in this folder.
+	static constexpr const char *PRECOMPILED_SHADER_CACHE_PATH = "res://.godot/exported_shader_cache";
+
+	// Copies the exported shader cache entries that are missing from the shader cache folder,
+	// so the first run of an exported project doesn't have to compile them.
+	static void seed_shader_cache(const String &p_shader_cache_dir);
+
 	static RendererCompositor *create();
 
 	virtual RendererUtilities *get_utilities() = 0;
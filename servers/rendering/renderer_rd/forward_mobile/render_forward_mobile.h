@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/templates/paged_allocator.h"
+#include "core/templates/radix_sort.h"
 #include "servers/rendering/renderer_rd/forward_mobile/scene_shader_forward_mobile.h"
 #include "servers/rendering/renderer_rd/renderer_scene_render_rd.h"
 
@@ -312,12 +313,37 @@ private:
 		LocalVector<GeometryInstanceSurfaceDataCache *> elements;
 		LocalVector<RenderElementInfo> element_info;
 
+		// Lists at least this large are radix sorted, smaller ones are faster to sort by comparison.
+		static constexpr uint32_t RADIX_SORT_THRESHOLD = 1024;
+
+		RadixSort<GeometryInstanceSurfaceDataCache *> radix_sort;
+		LocalVector<RadixSort<GeometryInstanceSurfaceDataCache *>::Element> radix_sort_elements;
+
 		void clear() {
 			elements.clear();
 			element_info.clear();
 		}
 
-		//should eventually be replaced by radix
+		void _radix_sort_by_key(uint32_t p_from, uint32_t p_size) {
+			GeometryInstanceSurfaceDataCache **list = elements.ptr() + p_from;
+			radix_sort_elements.resize(p_size);
+
+			// The sort key is 128 bits wide, so sort by the least significant half first and then by the most significant half.
+			for (uint32_t i = 0; i < p_size; i++) {
+				radix_sort_elements[i].key = list[i]->sort.sort_key1;
+				radix_sort_elements[i].value = list[i];
+			}
+			radix_sort.sort(radix_sort_elements.ptr(), p_size);
+
+			for (uint32_t i = 0; i < p_size; i++) {
+				radix_sort_elements[i].key = radix_sort_elements[i].value->sort.sort_key2;
+			}
+			radix_sort.sort(radix_sort_elements.ptr(), p_size);
+
+			for (uint32_t i = 0; i < p_size; i++) {
+				list[i] = radix_sort_elements[i].value;
+			}
+		}
 
 		struct SortByKey {
 			_FORCE_INLINE_ bool operator()(const GeometryInstanceSurfaceDataCache *A, const GeometryInstanceSurfaceDataCache *B) const {
@@ -326,11 +352,15 @@ private:
 		};
 
 		void sort_by_key() {
-			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
-			sorter.sort(elements.ptr(), elements.size());
+			sort_by_key_range(0, elements.size());
 		}
 
 		void sort_by_key_range(uint32_t p_from, uint32_t p_size) {
+			if (p_size >= RADIX_SORT_THRESHOLD) {
+				_radix_sort_by_key(p_from, p_size);
+				return;
+			}
+
 			SortArray<GeometryInstanceSurfaceDataCache *, SortByKey> sorter;
 			sorter.sort(elements.ptr() + p_from, p_size);
 		}
@@ -342,6 +372,22 @@ private:
 		};
 
 		void sort_by_depth() { //used for shadows
+			uint32_t size = elements.size();
+			if (size >= RADIX_SORT_THRESHOLD) {
+				radix_sort_elements.resize(size);
+				for (uint32_t i = 0; i < size; i++) {
+					// Flip the float bits so that their unsigned order matches the order of the float values.
+					uint32_t depth_bits;
+					memcpy(&depth_bits, &elements[i]->owner->depth, sizeof(uint32_t));
+					radix_sort_elements[i].key = (depth_bits & 0x80000000) ? ~depth_bits : (depth_bits | 0x80000000);
+					radix_sort_elements[i].value = elements[i];
+				}
+				radix_sort.sort(radix_sort_elements.ptr(), size);
+				for (uint32_t i = 0; i < size; i++) {
+					elements[i] = radix_sort_elements[i].value;
+				}
+				return;
+			}
 
 			SortArray<GeometryInstanceSurfaceDataCache *, SortByDepth> sorter;
 			sorter.sort(elements.ptr(), elements.size());
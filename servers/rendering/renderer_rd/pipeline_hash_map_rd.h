@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include "core/os/os.h"
+#include "servers/rendering/renderer_rd/storage_rd/utilities.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering_server.h"
 
@@ -185,9 +187,14 @@ public:
 			compile_pipeline(p_key, p_key_hash, p_source, p_wait_for_compilation);
 
 			if (p_wait_for_compilation) {
+				uint64_t wait_begin_usec = OS::get_singleton()->get_ticks_usec();
 				wait_for_pipeline(p_key_hash);
 				_add_new_pipelines_to_map();
 
+				if (RendererRD::Utilities::get_singleton() != nullptr) {
+					RendererRD::Utilities::get_singleton()->add_pipeline_compilation_stall_time(OS::get_singleton()->get_ticks_usec() - wait_begin_usec);
+				}
+
 				e = hash_map.find(p_key_hash);
 				if (e != nullptr) {
 					return e->value();
@@ -37,6 +37,7 @@
 #include "core/math/math_defs.h"
 #include "core/math/math_funcs.h"
 #include "core/math/transform_interpolator.h"
+#include "core/object/worker_thread_pool.h"
 #include "servers/rendering/renderer_rd/storage_rd/material_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/mesh_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/particles_storage.h"
@@ -2129,6 +2130,25 @@ uint32_t RendererCanvasRenderRD::get_pipeline_compilations(RS::PipelineSource p_
 }
 
 void RendererCanvasRenderRD::_render_batch_items(RenderTarget p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer, RenderingMethod::RenderInfo *r_render_info) {
+	// Light assignment only depends on the item, so it's computed up front, on worker threads for large canvases.
+	// Recording itself stays serial, as batching depends on item order.
+	// Without lights, every item shares the same empty state and the pass is skipped.
+	const ItemLightState no_light_state;
+	if (p_lights) {
+		item_light_states.resize(p_item_count);
+		if (uint32_t(p_item_count) >= ITEM_LIGHT_STATE_THREAD_THRESHOLD) {
+			ItemLightStateData data;
+			data.lights = p_lights;
+			data.item_count = p_item_count;
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasRenderRD::_compute_item_light_states_threaded, &data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CanvasItemLights"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (int i = 0; i < p_item_count; i++) {
+				_compute_item_light_state(items[i], p_lights, item_light_states[i]);
+			}
+		}
+	}
+
 	// Record batches
 	uint32_t instance_index = 0;
 	{
@@ -2181,7 +2201,7 @@ void RendererCanvasRenderRD::_render_batch_items(RenderTarget p_to_render_target
 
 			if (ci->repeat_source_item == nullptr || ci->repeat_size == Vector2()) {
 				Transform2D base_transform = p_canvas_transform_inverse * ci->final_transform;
-				_record_item_commands(ci, p_to_render_target, base_transform, current_clip, p_lights, instance_index, batch_broken, r_sdf_used, current_batch);
+				_record_item_commands(ci, p_to_render_target, base_transform, current_clip, p_lights ? item_light_states[i] : no_light_state, instance_index, batch_broken, r_sdf_used, current_batch);
 			} else {
 				Point2 start_pos = ci->repeat_size * -(ci->repeat_times / 2);
 				Point2 offset;
@@ -2194,7 +2214,7 @@ void RendererCanvasRenderRD::_render_batch_items(RenderTarget p_to_render_target
 						Transform2D base_transform = ci->final_transform;
 						base_transform.columns[2] += ci->repeat_source_item->final_transform.basis_xform(offset);
 						base_transform = p_canvas_transform_inverse * base_transform;
-						_record_item_commands(ci, p_to_render_target, base_transform, current_clip, p_lights, instance_index, batch_broken, r_sdf_used, current_batch);
+						_record_item_commands(ci, p_to_render_target, base_transform, current_clip, p_lights ? item_light_states[i] : no_light_state, instance_index, batch_broken, r_sdf_used, current_batch);
 					}
 				}
 			}
@@ -2327,7 +2347,49 @@ RendererCanvasRenderRD::InstanceData *RendererCanvasRenderRD::new_instance_data(
 	return instance_data;
 }
 
-void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, Light *p_lights, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch) {
+void RendererCanvasRenderRD::_compute_item_light_state(const Item *p_item, Light *p_lights, ItemLightState &r_state) const {
+	uint32_t light_count = 0;
+	uint32_t shadow_mask = 0;
+
+	r_state.lights[0] = 0;
+	r_state.lights[1] = 0;
+	r_state.lights[2] = 0;
+	r_state.lights[3] = 0;
+
+	Light *light = p_lights;
+	while (light) {
+		if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects(light->rect_cache)) {
+			uint32_t light_index = light->render_index_cache;
+			r_state.lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
+
+			if (p_item->light_mask & light->item_shadow_mask) {
+				shadow_mask |= 1 << light_count;
+			}
+
+			light_count++;
+
+			if (light_count == MAX_LIGHTS_PER_ITEM - 1) {
+				break;
+			}
+		}
+		light = light->next_ptr;
+	}
+
+	r_state.light_count = light_count;
+	r_state.base_flags = (light_count << INSTANCE_FLAGS_LIGHT_COUNT_SHIFT) | (shadow_mask << INSTANCE_FLAGS_SHADOW_MASKED_SHIFT);
+}
+
+void RendererCanvasRenderRD::_compute_item_light_states_threaded(uint32_t p_thread, ItemLightStateData *p_data) {
+	const uint32_t thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	const uint32_t from = p_thread * p_data->item_count / thread_count;
+	const uint32_t to = (p_thread + 1) * p_data->item_count / thread_count;
+
+	for (uint32_t i = from; i < to; i++) {
+		_compute_item_light_state(items[i], p_data->lights, item_light_states[i]);
+	}
+}
+
+void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, const ItemLightState &p_light_state, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch) {
 	const RenderingServer::CanvasItemTextureFilter texture_filter = p_item->texture_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT ? default_filter : p_item->texture_filter;
 	const RenderingServer::CanvasItemTextureRepeat texture_repeat = p_item->texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT ? default_repeat : p_item->texture_repeat;
 
@@ -2347,37 +2409,10 @@ void RendererCanvasRenderRD::_record_item_commands(const Item *p_item, RenderTar
 	bool skipping = false;
 
 	// TODO: consider making lights a per-batch property and then baking light operations in the shader for better performance.
-	uint32_t lights[4] = { 0, 0, 0, 0 };
-
-	uint16_t light_count = 0;
-	uint16_t shadow_mask = 0;
-
-	{
-		Light *light = p_lights;
-
-		while (light) {
-			if (light->render_index_cache >= 0 && p_item->light_mask & light->item_mask && p_item->z_final >= light->z_min && p_item->z_final <= light->z_max && p_item->global_rect_cache.intersects(light->rect_cache)) {
-				uint32_t light_index = light->render_index_cache;
-				lights[light_count >> 2] |= light_index << ((light_count & 3) * 8);
-
-				if (p_item->light_mask & light->item_shadow_mask) {
-					shadow_mask |= 1 << light_count;
-				}
-
-				light_count++;
-
-				if (light_count == MAX_LIGHTS_PER_ITEM - 1) {
-					break;
-				}
-			}
-			light = light->next_ptr;
-		}
-
-		base_flags |= light_count << INSTANCE_FLAGS_LIGHT_COUNT_SHIFT;
-		base_flags |= shadow_mask << INSTANCE_FLAGS_SHADOW_MASKED_SHIFT;
-	}
+	uint32_t lights[4] = { p_light_state.lights[0], p_light_state.lights[1], p_light_state.lights[2], p_light_state.lights[3] };
+	base_flags |= p_light_state.base_flags;
 
-	bool use_lighting = (light_count > 0 || using_directional_lights);
+	bool use_lighting = (p_light_state.light_count > 0 || using_directional_lights);
 
 	if (use_lighting != r_current_batch->use_lighting) {
 		r_current_batch = _new_batch(r_batch_broken);
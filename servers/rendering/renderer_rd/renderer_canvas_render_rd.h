@@ -594,6 +594,23 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	Item *items[MAX_RENDER_ITEMS];
 
+	// The lights affecting an item, packed the way they are stored in its instance data.
+	struct ItemLightState {
+		uint32_t lights[4] = { 0, 0, 0, 0 };
+		uint32_t base_flags = 0;
+		uint32_t light_count = 0;
+	};
+
+	struct ItemLightStateData {
+		Light *lights = nullptr;
+		uint32_t item_count = 0;
+	};
+
+	// Below this many items, computing light states isn't worth dispatching to worker threads.
+	static constexpr uint32_t ITEM_LIGHT_STATE_THREAD_THRESHOLD = 1024;
+
+	LocalVector<ItemLightState> item_light_states;
+
 	TextureInfo default_texture_info;
 
 	bool using_directional_lights = false;
@@ -622,7 +639,9 @@ class RendererCanvasRenderRD : public RendererCanvasRender {
 
 	inline RID _get_pipeline_specialization_or_ubershader(CanvasShaderData *p_shader_data, PipelineKey &r_pipeline_key, PushConstant &r_push_constant, RID p_mesh_instance = RID(), void *p_surface = nullptr, uint32_t p_surface_index = 0, RID *r_vertex_array = nullptr);
 	void _render_batch_items(RenderTarget p_to_render_target, int p_item_count, const Transform2D &p_canvas_transform_inverse, Light *p_lights, bool &r_sdf_used, bool p_to_backbuffer = false, RenderingMethod::RenderInfo *r_render_info = nullptr);
-	void _record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, Light *p_lights, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch);
+	void _compute_item_light_state(const Item *p_item, Light *p_lights, ItemLightState &r_state) const;
+	void _compute_item_light_states_threaded(uint32_t p_thread, ItemLightStateData *p_data);
+	void _record_item_commands(const Item *p_item, RenderTarget p_render_target, const Transform2D &p_base_transform, Item *&r_current_clip, const ItemLightState &p_light_state, uint32_t &r_index, bool &r_batch_broken, bool &r_sdf_used, Batch *&r_current_batch);
 	void _render_batch(RD::DrawListID p_draw_list, CanvasShaderData *p_shader_data, RenderingDevice::FramebufferFormatID p_framebuffer_format, Light *p_lights, Batch const *p_batch, RenderingMethod::RenderInfo *r_render_info = nullptr);
 	void _prepare_batch_texture_info(RID p_texture, TextureState &p_state, TextureInfo *p_info);
 	InstanceData *new_instance_data(float *p_world, uint32_t *p_lights, uint32_t p_base_flags, uint32_t p_index, uint32_t p_uniforms_ofs, TextureInfo *p_info);
@@ -301,6 +301,10 @@ RendererCompositorRD::RendererCompositorRD() {
 				}
 
 				if (!shader_cache_dir.is_empty()) {
+					if (!Engine::get_singleton()->is_editor_hint()) {
+						seed_shader_cache(shader_cache_dir);
+					}
+
 					bool compress = GLOBAL_GET("rendering/shader_compiler/shader_cache/compress");
 					bool use_zstd = GLOBAL_GET("rendering/shader_compiler/shader_cache/use_zstd_compression");
 					bool strip_debug = GLOBAL_GET("rendering/shader_compiler/shader_cache/strip_debug");
@@ -309,6 +313,8 @@ RendererCompositorRD::RendererCompositorRD() {
 					ShaderRD::set_shader_cache_save_compressed(compress);
 					ShaderRD::set_shader_cache_save_compressed_zstd(use_zstd);
 					ShaderRD::set_shader_cache_save_debug(!strip_debug);
+					uint64_t compiler_cache_max_size = uint64_t(int(GLOBAL_GET("rendering/shader_compiler/shader_cache/generated_code_max_size_mb"))) * 1024 * 1024;
+					ShaderCompiler::set_cache_dir(shader_cache_dir, compiler_cache_max_size);
 				}
 			}
 		}
@@ -764,7 +764,13 @@ bool ShaderRD::is_group_enabled(int p_group) const {
 
 bool ShaderRD::shader_cache_cleanup_on_start = false;
 
-ShaderRD::ShaderRD() {
+ShaderRD::ShaderRD() :
+		shader_list_element(this) {
+	{
+		MutexLock lock(shader_list_mutex);
+		shader_list.add(&shader_list_element);
+	}
+
 	// Do not feel forced to use this, in most cases it makes little to no difference.
 	bool use_32_threads = false;
 	if (RD::get_singleton()->get_device_vendor_name() == "NVIDIA") {
@@ -901,12 +907,58 @@ void ShaderRD::set_shader_cache_save_debug(bool p_enable) {
 	shader_cache_save_debug = p_enable;
 }
 
+SelfList<ShaderRD>::List ShaderRD::shader_list;
+Mutex ShaderRD::shader_list_mutex;
 String ShaderRD::shader_cache_dir;
 bool ShaderRD::shader_cache_save_compressed = true;
 bool ShaderRD::shader_cache_save_compressed_zstd = true;
 bool ShaderRD::shader_cache_save_debug = true;
 
+uint32_t ShaderRD::compile_all_versions() {
+	MutexLock lock(shader_list_mutex);
+
+	// Start compiling all the versions before waiting for any of them, so every shader compiles in parallel on the WorkerThreadPool.
+	LocalVector<Pair<ShaderRD *, RID>> versions;
+	for (SelfList<ShaderRD> *E = shader_list.first(); E; E = E->next()) {
+		ShaderRD *shader = E->self();
+		for (const RID &version_rid : shader->version_owner.get_owned_list()) {
+			Version *version = shader->version_owner.get_or_null(version_rid);
+			MutexLock version_lock(*version->mutex);
+
+			if (version->dirty) {
+				shader->_initialize_version(version);
+				for (int i = 0; i < shader->group_enabled.size(); i++) {
+					if (!shader->group_enabled[i]) {
+						shader->_allocate_placeholders(version, i);
+						continue;
+					}
+					shader->_compile_version_start(version, i);
+				}
+			}
+
+			versions.push_back({ shader, version_rid });
+		}
+	}
+
+	uint32_t valid_count = 0;
+	for (const Pair<ShaderRD *, RID> &pair : versions) {
+		Version *version = pair.first->version_owner.get_or_null(pair.second);
+		MutexLock version_lock(*version->mutex);
+		pair.first->_compile_ensure_finished(version);
+		if (version->valid) {
+			valid_count++;
+		}
+	}
+
+	return valid_count;
+}
+
 ShaderRD::~ShaderRD() {
+	{
+		MutexLock lock(shader_list_mutex);
+		shader_list.remove(&shader_list_element);
+	}
+
 	LocalVector<RID> remaining = version_owner.get_owned_list();
 	if (remaining.size()) {
 		ERR_PRINT(itos(remaining.size()) + " shaders of type " + name + " were never freed");
@@ -37,6 +37,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
+#include "core/templates/self_list.h"
 #include "servers/rendering_server.h"
 
 class ShaderRD {
@@ -128,6 +129,10 @@ private:
 	String base_sha256;
 	LocalVector<String> group_sha256;
 
+	static SelfList<ShaderRD>::List shader_list;
+	static Mutex shader_list_mutex;
+	SelfList<ShaderRD> shader_list_element;
+
 	static String shader_cache_dir;
 	static bool shader_cache_cleanup_on_start;
 	static bool shader_cache_save_compressed;
@@ -213,6 +218,9 @@ public:
 	static void set_shader_cache_save_compressed_zstd(bool p_enable);
 	static void set_shader_cache_save_debug(bool p_enable);
 
+	// Compiles the enabled groups of every version of every shader, storing them in the shader cache. Returns the number of valid versions.
+	static uint32_t compile_all_versions();
+
 	RS::ShaderNativeSourceCode version_get_native_source_code(RID p_version);
 
 	void initialize(const Vector<String> &p_variant_defines, const String &p_general_defines = "", const Vector<RD::PipelineImmutableSampler> &r_immutable_samplers = Vector<RD::PipelineImmutableSampler>());
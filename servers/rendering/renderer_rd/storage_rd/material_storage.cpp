@@ -2116,6 +2116,11 @@ RS::ShaderNativeSourceCode MaterialStorage::shader_get_native_source_code(RID p_
 	return RS::ShaderNativeSourceCode();
 }
 
+uint32_t MaterialStorage::shader_precompile_variants() {
+	// Material shaders and the renderer's internal shaders are all ShaderRD versions.
+	return ShaderRD::compile_all_versions();
+}
+
 /* MATERIAL API */
 
 void MaterialStorage::_material_uniform_set_erased(void *p_material) {
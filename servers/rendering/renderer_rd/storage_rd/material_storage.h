@@ -422,6 +422,7 @@ public:
 	void shader_set_data_request_function(ShaderType p_shader_type, ShaderDataRequestFunction p_function);
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const override;
+	virtual uint32_t shader_precompile_variants() override;
 
 	/* MATERIAL API */
 
@@ -2127,6 +2127,36 @@ void MeshStorage::_multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_
 	}
 }
 
+void MeshStorage::_multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) {
+	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
+	ERR_FAIL_NULL(multimesh);
+	ERR_FAIL_COND(multimesh->stride_cache == 0 || p_buffer.size() % multimesh->stride_cache != 0);
+	int instance_count = p_buffer.size() / multimesh->stride_cache;
+	ERR_FAIL_COND(p_from_instance < 0 || p_from_instance + instance_count > multimesh->instances);
+	if (instance_count == 0) {
+		return;
+	}
+
+	// Only the regions that contain the range are uploaded, by going through the same path as setting individual instances.
+	_multimesh_make_local(multimesh);
+
+	if (multimesh->xform_format == RS::MULTIMESH_TRANSFORM_3D) {
+		bool uses_motion_vectors = (RSG::viewport->get_num_viewports_with_motion_vectors() > 0) || (RendererCompositorStorage::get_singleton()->get_num_compositor_effects_with_motion_vectors() > 0);
+		if (uses_motion_vectors) {
+			_multimesh_enable_motion_vectors(multimesh);
+		}
+	}
+
+	_multimesh_update_motion_vectors_data_cache(multimesh);
+
+	float *w = multimesh->data_cache.ptrw();
+	memcpy(w + (multimesh->motion_vectors_current_offset + p_from_instance) * multimesh->stride_cache, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	for (int i = p_from_instance; i < p_from_instance + instance_count; i += MULTIMESH_DIRTY_REGION_SIZE - (i % MULTIMESH_DIRTY_REGION_SIZE)) {
+		_multimesh_mark_dirty(multimesh, i, true);
+	}
+}
+
 RID MeshStorage::_multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	MultiMesh *multimesh = multimesh_owner.get_or_null(p_multimesh);
 	ERR_FAIL_NULL_V(multimesh, RID());
@@ -2247,18 +2277,20 @@ void MeshStorage::_update_dirty_multimeshes() {
 				uint32_t visible_region_count = visible_instances == 0 ? 0 : Math::division_round_up(visible_instances, (uint32_t)MULTIMESH_DIRTY_REGION_SIZE);
 
 				uint32_t region_size = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * sizeof(float);
-				if (total_dirty_regions > 32 || total_dirty_regions > visible_region_count / 2) {
+				uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
+
+				// Adjacent dirty regions are uploaded together.
+				MultiMeshDirtyRun dirty_runs[MULTIMESH_MAX_DIRTY_RUNS];
+				int dirty_run_count = multimesh_get_dirty_runs(multimesh->data_cache_dirty_regions, multimesh->previous_data_cache_dirty_regions, visible_region_count, dirty_runs);
+
+				if (dirty_run_count < 0 || total_dirty_regions > visible_region_count / 2) {
 					//if there too many dirty regions, or represent the majority of regions, just copy all, else transfer cost piles up too much
-					RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float), MIN(visible_region_count * region_size, multimesh->instances * (uint32_t)multimesh->stride_cache * (uint32_t)sizeof(float)), data);
+					RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float), MIN(visible_region_count * region_size, size), data);
 				} else {
-					//not that many regions? update them all
-					for (uint32_t i = 0; i < visible_region_count; i++) {
-						if (multimesh->data_cache_dirty_regions[i] || multimesh->previous_data_cache_dirty_regions[i]) {
-							uint32_t offset = i * region_size;
-							uint32_t size = multimesh->stride_cache * (uint32_t)multimesh->instances * (uint32_t)sizeof(float);
-							uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * i;
-							RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float) + offset, MIN(region_size, size - offset), &data[region_start_index]);
-						}
+					for (int i = 0; i < dirty_run_count; i++) {
+						uint32_t offset = dirty_runs[i].from_region * region_size;
+						uint32_t region_start_index = multimesh->stride_cache * MULTIMESH_DIRTY_REGION_SIZE * dirty_runs[i].from_region;
+						RD::get_singleton()->buffer_update(multimesh->buffer, buffer_offset * sizeof(float) + offset, MIN(dirty_runs[i].region_count * region_size, size - offset), &data[region_start_index]);
 					}
 				}
 
@@ -2363,6 +2395,20 @@ int MeshStorage::skeleton_get_bone_count(RID p_skeleton) const {
 	return skeleton->size;
 }
 
+void MeshStorage::skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) {
+	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
+
+	ERR_FAIL_NULL(skeleton);
+	ERR_FAIL_COND(p_buffer.size() != skeleton->size * (skeleton->use_2d ? 8 : 12));
+	if (p_buffer.is_empty()) {
+		return;
+	}
+
+	memcpy(skeleton->data.ptr(), p_buffer.ptr(), p_buffer.size() * sizeof(float));
+
+	_skeleton_make_dirty(skeleton);
+}
+
 void MeshStorage::skeleton_bone_set_transform(RID p_skeleton, int p_bone, const Transform3D &p_transform) {
 	Skeleton *skeleton = skeleton_owner.get_or_null(p_skeleton);
 
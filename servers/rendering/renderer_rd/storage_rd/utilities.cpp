@@ -308,6 +308,8 @@ uint64_t Utilities::get_rendering_info(RS::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RS::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RS::RENDERING_INFO_PIPELINE_COMPILATION_STALL_TIME) {
+		return pipeline_compilation_stall_usec.get();
 	}
 	return 0;
 }
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/templates/rid_owner.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/rendering/storage/utilities.h"
 
 namespace RendererRD {
@@ -61,6 +62,8 @@ private:
 	uint64_t buffer_mem_cache = 0;
 	uint64_t total_mem_cache = 0;
 
+	SafeNumeric<uint64_t> pipeline_compilation_stall_usec;
+
 public:
 	static Utilities *get_singleton() { return singleton; }
 
@@ -112,6 +115,9 @@ public:
 
 	virtual uint64_t get_rendering_info(RS::RenderingInfo p_info) override;
 
+	// Can be called from any thread that had to wait for a pipeline to compile.
+	void add_pipeline_compilation_stall_time(uint64_t p_usec) { pipeline_compilation_stall_usec.add(p_usec); }
+
 	virtual String get_video_adapter_name() const override;
 	virtual String get_video_adapter_vendor() const override;
 	virtual RenderingDevice::DeviceType get_video_adapter_type() const override;
@@ -127,7 +127,8 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	// Used unless a module provides its own occlusion culling backend.
+	RendererSceneOcclusionCull *raster_occlusion_culling = nullptr;
 
 	/* SCENARIO API */
 
@@ -252,6 +253,61 @@ public:
 		}
 	};
 
+	struct InstanceBoundsBlock {
+		// Bounds of a block of consecutive instances in SoA layout, so frustum
+		// tests run over all instances of the block at once and vectorize.
+
+		static constexpr uint32_t SIZE = 64;
+
+		real_t bounds[6][SIZE];
+		uint32_t count = 0;
+
+		_FORCE_INLINE_ void load(const PagedArray<InstanceBounds> &p_instance_bounds, uint64_t p_from, uint32_t p_count) {
+			count = p_count;
+			for (uint32_t i = 0; i < p_count; i++) {
+				const InstanceBounds &ib = p_instance_bounds[p_from + i];
+				for (uint32_t j = 0; j < 6; j++) {
+					bounds[j][i] = ib.bounds[j];
+				}
+			}
+			// Unused lanes still take part in the tests, keep them deterministic.
+			for (uint32_t i = p_count; i < SIZE; i++) {
+				for (uint32_t j = 0; j < 6; j++) {
+					bounds[j][i] = 0;
+				}
+			}
+		}
+
+		// Same test as InstanceBounds::in_frustum(). Bit `i` is set if instance `i` of the block is inside.
+		uint64_t in_frustum_mask(const Frustum &p_frustum) const {
+			uint8_t inside[SIZE];
+			for (uint32_t i = 0; i < SIZE; i++) {
+				inside[i] = 1;
+			}
+
+			for (uint32_t p = 0; p < p_frustum.plane_count; p++) {
+				const Plane &plane = p_frustum.planes_ptr[p];
+				const real_t *bx = bounds[p_frustum.plane_signs_ptr[p].signs[0]];
+				const real_t *by = bounds[p_frustum.plane_signs_ptr[p].signs[1]];
+				const real_t *bz = bounds[p_frustum.plane_signs_ptr[p].signs[2]];
+				const real_t nx = plane.normal.x;
+				const real_t ny = plane.normal.y;
+				const real_t nz = plane.normal.z;
+				const real_t d = plane.d;
+
+				for (uint32_t i = 0; i < SIZE; i++) {
+					inside[i] &= uint8_t((nx * bx[i] + ny * by[i] + nz * bz[i]) - d < 0.0);
+				}
+			}
+
+			uint64_t mask = 0;
+			for (uint32_t i = 0; i < count; i++) {
+				mask |= uint64_t(inside[i]) << i;
+			}
+			return mask;
+		}
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -125,12 +125,6 @@ static uint32_t _get_device_type_score(const RenderingContextDriver::Device &p_d
 
 #define RENDER_GRAPH_FULL_BARRIERS 0
 
-// The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
-// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. However,
-// this setting is not enabled by default as it's been shown to cause some strange issues with certain IHVs that have yet to be understood.
-
-#define SECONDARY_COMMAND_BUFFERS_PER_FRAME 0
-
 RenderingDevice *RenderingDevice::singleton = nullptr;
 
 RenderingDevice *RenderingDevice::get_singleton() {
@@ -6796,8 +6790,19 @@ Error RenderingDevice::initialize(RenderingContextDriver *p_context, DisplayServ
 	driver->begin_segment(frame, frames_drawn++);
 	driver->command_buffer_begin(frames[0].command_buffer);
 
+	// The command graph can automatically issue secondary command buffers and record them on background threads when they reach an arbitrary
+	// size threshold. This can be very beneficial towards reducing the time the main thread takes to record all the rendering commands. It's
+	// been shown to cause some strange issues with certain IHVs that have yet to be understood, so projects can turn it off through the setting.
+	// It's only available on Vulkan, as the other drivers don't support it.
+	uint32_t secondary_command_buffers_per_frame = 0;
+	uint32_t secondary_command_buffer_min_draws = 0;
+	if (driver->get_api_name() == "Vulkan") {
+		secondary_command_buffers_per_frame = GLOBAL_GET("rendering/rendering_device/vulkan/secondary_command_buffers_per_frame");
+		secondary_command_buffer_min_draws = GLOBAL_GET("rendering/rendering_device/vulkan/secondary_command_buffer_min_draws");
+	}
+
 	// Create draw graph and start it initialized as well.
-	draw_graph.initialize(driver, device, &_render_pass_create_from_graph, frames.size(), main_queue_family, SECONDARY_COMMAND_BUFFERS_PER_FRAME);
+	draw_graph.initialize(driver, device, &_render_pass_create_from_graph, frames.size(), main_queue_family, secondary_command_buffers_per_frame, secondary_command_buffer_min_draws);
 	draw_graph.begin();
 
 	for (uint32_t i = 0; i < frames.size(); i++) {
@@ -958,6 +958,8 @@ void RenderingDeviceGraph::_add_draw_list_begin(FramebufferCache *p_framebuffer_
 	}
 
 	draw_instruction_list.split_cmd_buffer = p_split_cmd_buffer;
+	draw_instruction_list.draw_count = 0;
+	draw_instruction_list.has_subpasses = false;
 
 #if defined(DEBUG_ENABLED) || defined(DEV_ENABLED)
 	draw_instruction_list.breadcrumb = p_breadcrumb;
@@ -966,10 +968,54 @@ void RenderingDeviceGraph::_add_draw_list_begin(FramebufferCache *p_framebuffer_
 
 void RenderingDeviceGraph::_run_secondary_command_buffer_task(const SecondaryCommandBuffer *p_secondary) {
 	driver->command_buffer_begin_secondary(p_secondary->command_buffer, p_secondary->render_pass, 0, p_secondary->framebuffer);
-	_run_draw_list_command(p_secondary->command_buffer, p_secondary->instruction_data.ptr(), p_secondary->instruction_data.size());
+	_run_draw_list_command(p_secondary->command_buffer, p_secondary->instruction_data, p_secondary->instruction_data_size);
 	driver->command_buffer_end(p_secondary->command_buffer);
 }
 
+void RenderingDeviceGraph::_launch_secondary_command_buffer_tasks() {
+	Frame &f = frames[frame];
+	if (f.secondary_command_buffers.is_empty()) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < command_count && f.secondary_command_buffers_used < f.secondary_command_buffers.size(); i++) {
+		RecordedCommand *command = reinterpret_cast<RecordedCommand *>(&command_data[command_data_offsets[i]]);
+		if (command->type != RecordedCommand::TYPE_DRAW_LIST) {
+			continue;
+		}
+
+		RecordedDrawListCommand *draw_list_command = reinterpret_cast<RecordedDrawListCommand *>(command);
+
+		// Subpasses can't be split across command buffers, so those draw lists are always recorded on the primary command buffer.
+		if (draw_list_command->has_subpasses || draw_list_command->draw_count < secondary_command_buffer_min_draws) {
+			continue;
+		}
+
+		// The render pass must be resolved on this thread as it might need to be created. The final load and store operations are known at this point.
+		RDD::RenderPassID render_pass;
+		RDD::FramebufferID framebuffer;
+		if (draw_list_command->framebuffer_cache != nullptr) {
+			_get_draw_list_render_pass_and_framebuffer(draw_list_command, render_pass, framebuffer);
+		} else {
+			render_pass = draw_list_command->render_pass;
+			framebuffer = draw_list_command->framebuffer;
+		}
+
+		if (!framebuffer || !render_pass) {
+			continue;
+		}
+
+		draw_list_command->secondary_command_buffer_index = f.secondary_command_buffers_used++;
+
+		SecondaryCommandBuffer &secondary = f.secondary_command_buffers[draw_list_command->secondary_command_buffer_index];
+		secondary.instruction_data = draw_list_command->instruction_data();
+		secondary.instruction_data_size = draw_list_command->instruction_data_size;
+		secondary.render_pass = render_pass;
+		secondary.framebuffer = framebuffer;
+		secondary.task = WorkerThreadPool::get_singleton()->add_template_task(this, &RenderingDeviceGraph::_run_secondary_command_buffer_task, (const SecondaryCommandBuffer *)(&secondary), true, "RenderingDeviceGraph secondary command buffer");
+	}
+}
+
 void RenderingDeviceGraph::_wait_for_secondary_command_buffer_tasks() {
 	for (uint32_t i = 0; i < frames[frame].secondary_command_buffers_used; i++) {
 		WorkerThreadPool::TaskID &task = frames[frame].secondary_command_buffers[i].task;
@@ -1073,7 +1119,15 @@ void RenderingDeviceGraph::_run_render_commands(int32_t p_level, const RecordedC
 					framebuffer = draw_list_command->framebuffer;
 				}
 
-				if (framebuffer && render_pass) {
+				if (draw_list_command->secondary_command_buffer_index >= 0) {
+					// The contents were recorded on a worker thread, only wait for it when the command buffer is actually needed.
+					SecondaryCommandBuffer &secondary = frames[frame].secondary_command_buffers[draw_list_command->secondary_command_buffer_index];
+					driver->command_begin_render_pass(r_command_buffer, secondary.render_pass, secondary.framebuffer, RDD::COMMAND_BUFFER_TYPE_SECONDARY, draw_list_command->region, clear_values);
+					WorkerThreadPool::get_singleton()->wait_for_task_completion(secondary.task);
+					secondary.task = WorkerThreadPool::INVALID_TASK_ID;
+					driver->command_buffer_execute_secondary(r_command_buffer, secondary.command_buffer);
+					driver->command_end_render_pass(r_command_buffer);
+				} else if (framebuffer && render_pass) {
 					driver->command_begin_render_pass(r_command_buffer, render_pass, framebuffer, draw_list_command->command_buffer_type, draw_list_command->region, clear_values);
 					_run_draw_list_command(r_command_buffer, draw_list_command->instruction_data(), draw_list_command->instruction_data_size);
 					driver->command_end_render_pass(r_command_buffer);
@@ -1550,7 +1604,7 @@ void RenderingDeviceGraph::_print_compute_list(const uint8_t *p_instruction_data
 	}
 }
 
-void RenderingDeviceGraph::initialize(RDD *p_driver, RenderingContextDriver::Device p_device, RenderPassCreationFunction p_render_pass_creation_function, uint32_t p_frame_count, RDD::CommandQueueFamilyID p_secondary_command_queue_family, uint32_t p_secondary_command_buffers_per_frame) {
+void RenderingDeviceGraph::initialize(RDD *p_driver, RenderingContextDriver::Device p_device, RenderPassCreationFunction p_render_pass_creation_function, uint32_t p_frame_count, RDD::CommandQueueFamilyID p_secondary_command_queue_family, uint32_t p_secondary_command_buffers_per_frame, uint32_t p_secondary_command_buffer_min_draws) {
 	DEV_ASSERT(p_driver != nullptr);
 	DEV_ASSERT(p_render_pass_creation_function != nullptr);
 	DEV_ASSERT(p_frame_count > 0);
@@ -1558,6 +1612,7 @@ void RenderingDeviceGraph::initialize(RDD *p_driver, RenderingContextDriver::Dev
 	driver = p_driver;
 	device = p_device;
 	render_pass_creation_function = p_render_pass_creation_function;
+	secondary_command_buffer_min_draws = MAX(p_secondary_command_buffer_min_draws, 1U);
 	frames.resize(p_frame_count);
 
 	for (uint32_t i = 0; i < p_frame_count; i++) {
@@ -1895,6 +1950,7 @@ void RenderingDeviceGraph::add_draw_list_draw(uint32_t p_vertex_count, uint32_t
 	instruction->type = DrawListInstruction::TYPE_DRAW;
 	instruction->vertex_count = p_vertex_count;
 	instruction->instance_count = p_instance_count;
+	draw_instruction_list.draw_count++;
 }
 
 void RenderingDeviceGraph::add_draw_list_draw_indexed(uint32_t p_index_count, uint32_t p_instance_count, uint32_t p_first_index) {
@@ -1903,6 +1959,7 @@ void RenderingDeviceGraph::add_draw_list_draw_indexed(uint32_t p_index_count, ui
 	instruction->index_count = p_index_count;
 	instruction->instance_count = p_instance_count;
 	instruction->first_index = p_first_index;
+	draw_instruction_list.draw_count++;
 }
 
 void RenderingDeviceGraph::add_draw_list_draw_indirect(RDD::BufferID p_buffer, uint32_t p_offset, uint32_t p_draw_count, uint32_t p_stride) {
@@ -1912,6 +1969,7 @@ void RenderingDeviceGraph::add_draw_list_draw_indirect(RDD::BufferID p_buffer, u
 	instruction->offset = p_offset;
 	instruction->draw_count = p_draw_count;
 	instruction->stride = p_stride;
+	draw_instruction_list.draw_count += p_draw_count;
 	draw_instruction_list.stages.set_flag(RDD::PIPELINE_STAGE_DRAW_INDIRECT_BIT);
 }
 
@@ -1922,6 +1980,7 @@ void RenderingDeviceGraph::add_draw_list_draw_indexed_indirect(RDD::BufferID p_b
 	instruction->offset = p_offset;
 	instruction->draw_count = p_draw_count;
 	instruction->stride = p_stride;
+	draw_instruction_list.draw_count += p_draw_count;
 	draw_instruction_list.stages.set_flag(RDD::PIPELINE_STAGE_DRAW_INDIRECT_BIT);
 }
 
@@ -1935,6 +1994,7 @@ void RenderingDeviceGraph::add_draw_list_next_subpass(RDD::CommandBufferType p_c
 	DrawListNextSubpassInstruction *instruction = reinterpret_cast<DrawListNextSubpassInstruction *>(_allocate_draw_list_instruction(sizeof(DrawListNextSubpassInstruction)));
 	instruction->type = DrawListInstruction::TYPE_NEXT_SUBPASS;
 	instruction->command_buffer_type = p_command_buffer_type;
+	draw_instruction_list.has_subpasses = true;
 }
 
 void RenderingDeviceGraph::add_draw_list_set_blend_constants(const Color &p_color) {
@@ -2023,6 +2083,9 @@ void RenderingDeviceGraph::add_draw_list_end() {
 	command->breadcrumb = draw_instruction_list.breadcrumb;
 #endif
 	command->split_cmd_buffer = draw_instruction_list.split_cmd_buffer;
+	command->draw_count = draw_instruction_list.draw_count;
+	command->secondary_command_buffer_index = -1;
+	command->has_subpasses = draw_instruction_list.has_subpasses;
 	command->clear_values_count = draw_instruction_list.attachment_clear_values.size();
 	command->trackers_count = trackers_count;
 
@@ -2351,6 +2414,9 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 	_wait_for_secondary_command_buffer_tasks();
 
 	if (command_count > 0) {
+		// Large draw lists are recorded on worker threads while the rest of the graph is replayed.
+		_launch_secondary_command_buffer_tasks();
+
 		int32_t current_label_index = -1;
 		int32_t current_label_level = -1;
 		_run_label_command_change(r_command_buffer, -1, -1, true, true, nullptr, 0, current_label_index, current_label_level);
@@ -89,6 +89,10 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 
 	RSG::rasterizer->end_frame(p_swap_buffers);
 
+	uint64_t compilations_total = _get_pipeline_compilations_total();
+	pipeline_compilations_in_frame = compilations_total - pipeline_compilations_total;
+	pipeline_compilations_total = compilations_total;
+
 #ifndef XR_DISABLED
 	XRServer *xr_server = XRServer::get_singleton();
 	if (xr_server != nullptr) {
@@ -274,6 +278,14 @@ void RenderingServerDefault::finish() {
 
 /* STATUS INFORMATION */
 
+uint64_t RenderingServerDefault::_get_pipeline_compilations_total() {
+	uint64_t total = 0;
+	for (int i = 0; i < PIPELINE_SOURCE_MAX; i++) {
+		total += RSG::canvas_render->get_pipeline_compilations(PipelineSource(i)) + RSG::scene->get_pipeline_compilations(PipelineSource(i));
+	}
+	return total;
+}
+
 uint64_t RenderingServerDefault::get_rendering_info(RenderingInfo p_info) {
 	if (p_info == RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME) {
 		return RSG::viewport->get_total_objects_drawn();
@@ -291,6 +303,8 @@ uint64_t RenderingServerDefault::get_rendering_info(RenderingInfo p_info) {
 		return RSG::canvas_render->get_pipeline_compilations(PIPELINE_SOURCE_DRAW) + RSG::scene->get_pipeline_compilations(PIPELINE_SOURCE_DRAW);
 	} else if (p_info == RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION) {
 		return RSG::canvas_render->get_pipeline_compilations(PIPELINE_SOURCE_SPECIALIZATION) + RSG::scene->get_pipeline_compilations(PIPELINE_SOURCE_SPECIALIZATION);
+	} else if (p_info == RENDERING_INFO_PIPELINE_COMPILATIONS_IN_FRAME) {
+		return pipeline_compilations_in_frame;
 	}
 	return RSG::utilities->get_rendering_info(p_info);
 }
@@ -68,6 +68,11 @@ class RenderingServerDefault : public RenderingServer {
 
 	double frame_setup_time = 0;
 
+	uint64_t pipeline_compilations_total = 0;
+	uint64_t pipeline_compilations_in_frame = 0;
+
+	uint64_t _get_pipeline_compilations_total();
+
 	//for printing
 	bool print_gpu_profile = false;
 	HashMap<String, float> print_gpu_profile_task_time;
@@ -276,6 +281,7 @@ public:
 	FUNC2RC(Variant, shader_get_parameter_default, RID, const StringName &)
 
 	FUNC1RC(ShaderNativeSourceCode, shader_get_native_source_code, RID)
+	FUNC0R(uint32_t, shader_precompile_variants)
 
 	/* COMMON MATERIAL API */
 
@@ -406,6 +412,7 @@ public:
 	FUNC2RC(Color, multimesh_instance_get_custom_data, RID, int)
 
 	FUNC2(multimesh_set_buffer, RID, const Vector<float> &)
+	FUNC3(multimesh_set_buffer_range, RID, int, const Vector<float> &)
 	FUNC1RC(RID, multimesh_get_command_buffer_rd_rid, RID)
 	FUNC1RC(RID, multimesh_get_buffer_rd_rid, RID)
 	FUNC1RC(Vector<float>, multimesh_get_buffer, RID)
@@ -428,6 +435,7 @@ public:
 	FUNC3(skeleton_bone_set_transform_2d, RID, int, const Transform2D &)
 	FUNC2RC(Transform2D, skeleton_bone_get_transform_2d, RID, int)
 	FUNC2(skeleton_set_base_transform_2d, RID, const Transform2D &)
+	FUNC2(skeleton_set_buffer, RID, const Vector<float> &)
 
 	/* Light API */
 #undef ServerName
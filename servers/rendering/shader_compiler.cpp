@@ -32,6 +32,10 @@
 
 #include "shader_compiler.h"
 
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/string/string_builder.h"
+#include "core/version.h"
 #include "servers/rendering/rendering_server_globals.h"
 #include "servers/rendering/shader_types.h"
 
@@ -1461,7 +1465,7 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 	return (ShaderLanguage::DataType)RS::global_shader_uniform_type_get_shader_datatype(gvt);
 }
 
-Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+Error ShaderCompiler::_compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1570,9 +1574,359 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	return OK;
 }
 
+static const char *compiler_cache_file_header = "RSCC";
+static const uint32_t compiler_cache_file_version = 1;
+
+String ShaderCompiler::_get_cache_key(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) const {
+	StringBuilder hash_build;
+	hash_build.append(actions_sha256);
+	hash_build.append(itos(p_mode));
+	hash_build.append("[entry_points]");
+	for (const KeyValue<StringName, Stage> &E : p_actions->entry_point_stages) {
+		hash_build.append(String(E.key) + ":" + itos(E.value) + ",");
+	}
+	hash_build.append("[render_mode_values]");
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		hash_build.append(String(E.key) + ":" + itos(E.value.second) + ",");
+	}
+	hash_build.append("[render_mode_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->render_mode_flags) {
+		hash_build.append(String(E.key) + ",");
+	}
+	hash_build.append("[usage_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->usage_flag_pointers) {
+		hash_build.append(String(E.key) + ",");
+	}
+	hash_build.append("[write_flags]");
+	for (const KeyValue<StringName, bool *> &E : p_actions->write_flag_pointers) {
+		hash_build.append(String(E.key) + ",");
+	}
+	hash_build.append("[code]");
+	hash_build.append(p_code);
+	return hash_build.as_string().sha256_text();
+}
+
+static void _store_scalars(Ref<FileAccess> p_file, const Vector<SL::Scalar> &p_scalars) {
+	p_file->store_32(p_scalars.size());
+	for (const SL::Scalar &scalar : p_scalars) {
+		p_file->store_32(scalar.uint);
+	}
+}
+
+static Vector<SL::Scalar> _get_scalars(Ref<FileAccess> p_file) {
+	Vector<SL::Scalar> scalars;
+	uint32_t count = p_file->get_32();
+	if (count > p_file->get_length()) {
+		return scalars; // Corrupt file, the caller checks for errors.
+	}
+	scalars.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		scalars.write[i].uint = p_file->get_32();
+	}
+	return scalars;
+}
+
+static void _store_strings(Ref<FileAccess> p_file, const Vector<String> &p_strings) {
+	p_file->store_32(p_strings.size());
+	for (const String &string : p_strings) {
+		p_file->store_pascal_string(string);
+	}
+}
+
+static Vector<String> _get_strings(Ref<FileAccess> p_file) {
+	Vector<String> strings;
+	uint32_t count = p_file->get_32();
+	if (count > p_file->get_length()) {
+		return strings; // Corrupt file, the caller checks for errors.
+	}
+	strings.resize(count);
+	for (uint32_t i = 0; i < count; i++) {
+		strings.write[i] = p_file->get_pascal_string();
+	}
+	return strings;
+}
+
+bool ShaderCompiler::_load_from_cache(const String &p_key, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	Ref<FileAccess> f = FileAccess::open(cache_dir.path_join(p_key + ".cache"), FileAccess::READ);
+	if (f.is_null()) {
+		return false;
+	}
+
+	char header[5] = { 0, 0, 0, 0, 0 };
+	f->get_buffer((uint8_t *)header, 4);
+	if (header != String(compiler_cache_file_header) || f->get_32() != compiler_cache_file_version) {
+		return false;
+	}
+
+	GeneratedCode gen_code;
+	gen_code.defines = _get_strings(f);
+	uint32_t texture_count = f->get_32();
+	ERR_FAIL_COND_V(texture_count > f->get_length(), false);
+	gen_code.texture_uniforms.resize(texture_count);
+	for (GeneratedCode::Texture &texture : gen_code.texture_uniforms) {
+		texture.name = f->get_pascal_string();
+		texture.type = SL::DataType(f->get_32());
+		texture.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+		texture.use_color = f->get_8();
+		texture.filter = SL::TextureFilter(f->get_32());
+		texture.repeat = SL::TextureRepeat(f->get_32());
+		texture.global = f->get_8();
+		texture.array_size = f->get_32();
+	}
+	uint32_t offset_count = f->get_32();
+	ERR_FAIL_COND_V(offset_count > f->get_length(), false);
+	gen_code.uniform_offsets.resize(offset_count);
+	for (uint32_t i = 0; i < offset_count; i++) {
+		gen_code.uniform_offsets.write[i] = f->get_32();
+	}
+	gen_code.uniform_total_size = f->get_32();
+	gen_code.uniforms = f->get_pascal_string();
+	for (int i = 0; i < STAGE_MAX; i++) {
+		gen_code.stage_globals[i] = f->get_pascal_string();
+	}
+	uint32_t code_count = f->get_32();
+	ERR_FAIL_COND_V(code_count > f->get_length(), false);
+	for (uint32_t i = 0; i < code_count; i++) {
+		String name = f->get_pascal_string();
+		gen_code.code[name] = f->get_pascal_string();
+	}
+	gen_code.uses_global_textures = f->get_8();
+	gen_code.uses_fragment_time = f->get_8();
+	gen_code.uses_vertex_time = f->get_8();
+	gen_code.uses_screen_texture_mipmaps = f->get_8();
+	gen_code.uses_screen_texture = f->get_8();
+	gen_code.uses_depth_texture = f->get_8();
+	gen_code.uses_normal_roughness_texture = f->get_8();
+
+	Vector<String> render_mode_values = _get_strings(f);
+	Vector<String> render_mode_flags = _get_strings(f);
+	Vector<String> usage_flags = _get_strings(f);
+	Vector<String> write_flags = _get_strings(f);
+
+	uint32_t uniform_count = f->get_32();
+	ERR_FAIL_COND_V(uniform_count > f->get_length(), false);
+	Vector<Pair<StringName, SL::ShaderNode::Uniform>> uniforms;
+	uniforms.resize(uniform_count);
+	for (Pair<StringName, SL::ShaderNode::Uniform> &E : uniforms) {
+		E.first = f->get_pascal_string();
+		SL::ShaderNode::Uniform &uniform = E.second;
+		uniform.order = int32_t(f->get_32());
+		uniform.prop_order = int32_t(f->get_32());
+		uniform.texture_order = int32_t(f->get_32());
+		uniform.texture_binding = int32_t(f->get_32());
+		uniform.type = SL::DataType(f->get_32());
+		uniform.precision = SL::DataPrecision(f->get_32());
+		uniform.array_size = int32_t(f->get_32());
+		uniform.default_value = _get_scalars(f);
+		uniform.scope = SL::ShaderNode::Uniform::Scope(f->get_32());
+		uniform.hint = SL::ShaderNode::Uniform::Hint(f->get_32());
+		uniform.use_color = f->get_8();
+		uniform.filter = SL::TextureFilter(f->get_32());
+		uniform.repeat = SL::TextureRepeat(f->get_32());
+		for (int i = 0; i < 3; i++) {
+			uniform.hint_range[i] = f->get_float();
+		}
+		uniform.hint_enum_names = _get_strings(f);
+		uniform.instance_index = int32_t(f->get_32());
+		uniform.group = f->get_pascal_string();
+		uniform.subgroup = f->get_pascal_string();
+
+		if (uniform.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL && _get_global_shader_uniform_type(E.first) != uniform.type) {
+			return false; // The global uniform changed since the shader was cached, it must be validated again.
+		}
+	}
+
+	// The footer is written last, so files that were only partially written are rejected.
+	f->get_buffer((uint8_t *)header, 4);
+	if (f->get_error() != OK || header != String(compiler_cache_file_header)) {
+		return false;
+	}
+
+	for (const String &name : render_mode_values) {
+		Pair<int *, int> *value = p_actions->render_mode_values.getptr(name);
+		ERR_FAIL_NULL_V(value, false);
+		*value->first = value->second;
+	}
+	for (const String &name : render_mode_flags) {
+		bool **flag = p_actions->render_mode_flags.getptr(name);
+		ERR_FAIL_NULL_V(flag, false);
+		**flag = true;
+	}
+	for (const String &name : usage_flags) {
+		bool **flag = p_actions->usage_flag_pointers.getptr(name);
+		ERR_FAIL_NULL_V(flag, false);
+		**flag = true;
+	}
+	for (const String &name : write_flags) {
+		bool **flag = p_actions->write_flag_pointers.getptr(name);
+		ERR_FAIL_NULL_V(flag, false);
+		**flag = true;
+	}
+	if (p_actions->uniforms) {
+		for (const Pair<StringName, SL::ShaderNode::Uniform> &E : uniforms) {
+			p_actions->uniforms->insert(E.first, E.second);
+		}
+	}
+
+	r_gen_code = gen_code;
+	return true;
+}
+
+void ShaderCompiler::_save_to_cache(const String &p_key, const IdentifierActions *p_actions, const GeneratedCode &p_gen_code) {
+	Ref<FileAccess> f = FileAccess::open(cache_dir.path_join(p_key + ".cache"), FileAccess::WRITE);
+	ERR_FAIL_COND(f.is_null());
+
+	f->store_buffer((const uint8_t *)compiler_cache_file_header, 4);
+	f->store_32(compiler_cache_file_version);
+
+	_store_strings(f, p_gen_code.defines);
+	f->store_32(p_gen_code.texture_uniforms.size());
+	for (const GeneratedCode::Texture &texture : p_gen_code.texture_uniforms) {
+		f->store_pascal_string(texture.name);
+		f->store_32(texture.type);
+		f->store_32(texture.hint);
+		f->store_8(texture.use_color);
+		f->store_32(texture.filter);
+		f->store_32(texture.repeat);
+		f->store_8(texture.global);
+		f->store_32(texture.array_size);
+	}
+	f->store_32(p_gen_code.uniform_offsets.size());
+	for (uint32_t offset : p_gen_code.uniform_offsets) {
+		f->store_32(offset);
+	}
+	f->store_32(p_gen_code.uniform_total_size);
+	f->store_pascal_string(p_gen_code.uniforms);
+	for (int i = 0; i < STAGE_MAX; i++) {
+		f->store_pascal_string(p_gen_code.stage_globals[i]);
+	}
+	f->store_32(p_gen_code.code.size());
+	for (const KeyValue<String, String> &E : p_gen_code.code) {
+		f->store_pascal_string(E.key);
+		f->store_pascal_string(E.value);
+	}
+	f->store_8(p_gen_code.uses_global_textures);
+	f->store_8(p_gen_code.uses_fragment_time);
+	f->store_8(p_gen_code.uses_vertex_time);
+	f->store_8(p_gen_code.uses_screen_texture_mipmaps);
+	f->store_8(p_gen_code.uses_screen_texture);
+	f->store_8(p_gen_code.uses_depth_texture);
+	f->store_8(p_gen_code.uses_normal_roughness_texture);
+
+	// Record which of the caller's render modes and flags ended up set, so a cache hit can set them again.
+	Vector<String> render_mode_values;
+	for (const KeyValue<StringName, Pair<int *, int>> &E : p_actions->render_mode_values) {
+		if (*E.value.first == E.value.second) {
+			render_mode_values.push_back(E.key);
+		}
+	}
+	_store_strings(f, render_mode_values);
+
+	const HashMap<StringName, bool *> *flag_maps[3] = { &p_actions->render_mode_flags, &p_actions->usage_flag_pointers, &p_actions->write_flag_pointers };
+	for (const HashMap<StringName, bool *> *flag_map : flag_maps) {
+		Vector<String> flags;
+		for (const KeyValue<StringName, bool *> &E : *flag_map) {
+			if (*E.value) {
+				flags.push_back(E.key);
+			}
+		}
+		_store_strings(f, flags);
+	}
+
+	f->store_32(p_actions->uniforms ? p_actions->uniforms->size() : 0);
+	if (p_actions->uniforms) {
+		for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : *p_actions->uniforms) {
+			const SL::ShaderNode::Uniform &uniform = E.value;
+			f->store_pascal_string(E.key);
+			f->store_32(uniform.order);
+			f->store_32(uniform.prop_order);
+			f->store_32(uniform.texture_order);
+			f->store_32(uniform.texture_binding);
+			f->store_32(uniform.type);
+			f->store_32(uniform.precision);
+			f->store_32(uniform.array_size);
+			_store_scalars(f, uniform.default_value);
+			f->store_32(uniform.scope);
+			f->store_32(uniform.hint);
+			f->store_8(uniform.use_color);
+			f->store_32(uniform.filter);
+			f->store_32(uniform.repeat);
+			for (int i = 0; i < 3; i++) {
+				f->store_float(uniform.hint_range[i]);
+			}
+			_store_strings(f, uniform.hint_enum_names);
+			f->store_32(uniform.instance_index);
+			f->store_pascal_string(uniform.group);
+			f->store_pascal_string(uniform.subgroup);
+		}
+	}
+
+	f->store_buffer((const uint8_t *)compiler_cache_file_header, 4);
+}
+
+Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	String cache_key;
+	if (!cache_dir.is_empty()) {
+		cache_key = _get_cache_key(p_mode, p_code, p_actions);
+		if (_load_from_cache(cache_key, p_actions, r_gen_code)) {
+			return OK;
+		}
+	}
+
+	ShaderCompiler *worker = nullptr;
+	{
+		MutexLock lock(workers_mutex);
+		if (idle_workers.is_empty()) {
+			worker = memnew(ShaderCompiler);
+			worker->initialize(actions);
+		} else {
+			worker = idle_workers[idle_workers.size() - 1];
+			idle_workers.resize(idle_workers.size() - 1);
+		}
+	}
+
+	Error err = worker->_compile(p_mode, p_code, p_actions, p_path, r_gen_code);
+
+	{
+		MutexLock lock(workers_mutex);
+		idle_workers.push_back(worker);
+	}
+
+	if (err == OK && !cache_key.is_empty()) {
+		_save_to_cache(cache_key, p_actions, r_gen_code);
+	}
+
+	return err;
+}
+
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
 
+	StringBuilder hash_build;
+	hash_build.append(REDOT_VERSION_FULL_BUILD);
+	hash_build.append(REDOT_VERSION_HASH);
+	hash_build.append("[renames]");
+	for (const KeyValue<StringName, String> &E : actions.renames) {
+		hash_build.append(String(E.key) + "=" + E.value + "\n");
+	}
+	hash_build.append("[render_mode_defines]");
+	for (const KeyValue<StringName, String> &E : actions.render_mode_defines) {
+		hash_build.append(String(E.key) + "=" + E.value + "\n");
+	}
+	hash_build.append("[usage_defines]");
+	for (const KeyValue<StringName, String> &E : actions.usage_defines) {
+		hash_build.append(String(E.key) + "=" + E.value + "\n");
+	}
+	hash_build.append("[custom_samplers]");
+	for (const KeyValue<StringName, String> &E : actions.custom_samplers) {
+		hash_build.append(String(E.key) + "=" + E.value + "\n");
+	}
+	hash_build.append("[settings]");
+	hash_build.append(itos(actions.default_filter) + "," + itos(actions.default_repeat) + "," + itos(actions.base_texture_binding_index) + "," + itos(actions.texture_layout_set) + ",");
+	hash_build.append(actions.base_uniform_string + "," + actions.global_buffer_array_variable + "," + actions.instance_uniform_index_variable + ",");
+	hash_build.append(itos(actions.base_varying_index) + "," + itos(actions.apply_luminance_multiplier) + "," + itos(actions.check_multiview_samplers));
+	actions_sha256 = hash_build.as_string().sha256_text();
+
 	time_name = "TIME";
 
 	List<String> func_list;
@@ -1595,5 +1949,73 @@ void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	texture_functions.insert("texelFetch");
 }
 
+void ShaderCompiler::_cleanup_cache(uint64_t p_max_size) {
+	Ref<DirAccess> da = DirAccess::open(cache_dir);
+	ERR_FAIL_COND(da.is_null());
+
+	struct CacheFile {
+		String path;
+		uint64_t modified_time = 0;
+		uint64_t size = 0;
+
+		bool operator<(const CacheFile &p_other) const {
+			return modified_time == p_other.modified_time ? path < p_other.path : modified_time < p_other.modified_time;
+		}
+	};
+
+	LocalVector<CacheFile> files;
+	uint64_t total_size = 0;
+	for (const String &file : da->get_files()) {
+		if (file.get_extension() != "cache") {
+			continue;
+		}
+		CacheFile cache_file;
+		cache_file.path = cache_dir.path_join(file);
+		cache_file.modified_time = FileAccess::get_modified_time(cache_file.path);
+		cache_file.size = MAX(FileAccess::get_size(cache_file.path), 0);
+		total_size += cache_file.size;
+		files.push_back(cache_file);
+	}
+
+	if (total_size <= p_max_size) {
+		return;
+	}
+
+	// The oldest entries were written the longest ago, so they most likely belong to shaders that changed or were removed since.
+	files.sort();
+	for (const CacheFile &cache_file : files) {
+		if (total_size <= p_max_size) {
+			break;
+		}
+		if (da->remove(cache_file.path) == OK) {
+			total_size -= cache_file.size;
+		}
+	}
+}
+
+void ShaderCompiler::set_cache_dir(const String &p_dir, uint64_t p_max_size) {
+	cache_dir = String();
+	if (p_dir.is_empty()) {
+		return;
+	}
+
+	String dir = p_dir.path_join("ShaderCompiler");
+	Ref<DirAccess> da = DirAccess::open(p_dir);
+	ERR_FAIL_COND_MSG(da.is_null() || (!da->dir_exists(dir) && da->make_dir(dir) != OK), "Can't create the shader compiler cache folder, generated shader code won't be cached: " + dir);
+	cache_dir = dir;
+
+	if (p_max_size > 0) {
+		_cleanup_cache(p_max_size);
+	}
+}
+
+String ShaderCompiler::cache_dir;
+
 ShaderCompiler::ShaderCompiler() {
 }
+
+ShaderCompiler::~ShaderCompiler() {
+	for (ShaderCompiler *worker : idle_workers) {
+		memdelete(worker);
+	}
+}
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering_server.h"
@@ -125,12 +127,38 @@ private:
 	HashSet<StringName> fragment_varyings;
 
 	DefaultIdentifierActions actions;
+	String actions_sha256;
+
+	// Parsing and code generation keep state in the compiler, so concurrent compiles
+	// each borrow their own worker compiler from this pool.
+	Mutex workers_mutex;
+	LocalVector<ShaderCompiler *> idle_workers;
+
+	static String cache_dir;
+
+	// Removes the oldest entries until the cache takes at most `p_max_size` bytes.
+	static void _cleanup_cache(uint64_t p_max_size);
 
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	Error _compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
+
+	String _get_cache_key(RS::ShaderMode p_mode, const String &p_code, const IdentifierActions *p_actions) const;
+	bool _load_from_cache(const String &p_key, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+	void _save_to_cache(const String &p_key, const IdentifierActions *p_actions, const GeneratedCode &p_gen_code);
+
 public:
+	// Thread-safe. The values pointed to by `p_actions` must be reset by the caller before compiling,
+	// as cached results only replay the flags, render modes and uniforms that the shader sets.
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
 	void initialize(DefaultIdentifierActions p_actions);
+
+	// Generated code is cached in this directory, keyed by the shader code and compiler configuration.
+	// An empty path disables the cache. If `p_max_size` isn't 0, the oldest entries are removed
+	// until the cache takes at most that many bytes.
+	static void set_cache_dir(const String &p_dir, uint64_t p_max_size = 0);
+
 	ShaderCompiler();
+	~ShaderCompiler();
 };
@@ -71,6 +71,7 @@ public:
 	virtual Variant shader_get_parameter_default(RID p_material, const StringName &p_param) const = 0;
 
 	virtual RS::ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const = 0;
+	virtual uint32_t shader_precompile_variants() = 0;
 
 	/* MATERIAL API */
 
@@ -38,6 +38,32 @@
 #include "core/config/project_settings.h"
 #endif
 
+int RendererMeshStorage::multimesh_get_dirty_runs(const bool *p_dirty_regions, const bool *p_previous_dirty_regions, uint32_t p_region_count, MultiMeshDirtyRun *r_runs) {
+	int run_count = 0;
+	uint32_t i = 0;
+	while (i < p_region_count) {
+		if (!p_dirty_regions[i] && !(p_previous_dirty_regions && p_previous_dirty_regions[i])) {
+			i++;
+			continue;
+		}
+
+		if (run_count == (int)MULTIMESH_MAX_DIRTY_RUNS) {
+			return -1;
+		}
+
+		uint32_t run_start = i;
+		while (i < p_region_count && (p_dirty_regions[i] || (p_previous_dirty_regions && p_previous_dirty_regions[i]))) {
+			i++;
+		}
+
+		r_runs[run_count].from_region = run_start;
+		r_runs[run_count].region_count = i - run_start;
+		run_count++;
+	}
+
+	return run_count;
+}
+
 RID RendererMeshStorage::multimesh_allocate() {
 	return _multimesh_allocate();
 }
@@ -225,6 +251,28 @@ void RendererMeshStorage::multimesh_set_buffer(RID p_multimesh, const Vector<flo
 	_multimesh_set_buffer(p_multimesh, p_buffer);
 }
 
+void RendererMeshStorage::multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) {
+	MultiMeshInterpolator *mmi = _multimesh_get_interpolator(p_multimesh);
+	if (mmi && mmi->interpolated) {
+		ERR_FAIL_COND_MSG(mmi->_stride == 0 || p_buffer.size() % mmi->_stride != 0, vformat("Buffer size should be a multiple of %d elements, got %d instead.", mmi->_stride, p_buffer.size()));
+		int instance_count = p_buffer.size() / mmi->_stride;
+		ERR_FAIL_COND(p_from_instance < 0 || p_from_instance + instance_count > mmi->_num_instances);
+
+		memcpy(mmi->_data_curr.ptrw() + p_from_instance * mmi->_stride, p_buffer.ptr(), p_buffer.size() * sizeof(float));
+		_multimesh_add_to_interpolation_lists(p_multimesh, *mmi);
+
+#if defined(DEBUG_ENABLED) && defined(TOOLS_ENABLED)
+		if (!Engine::get_singleton()->is_in_physics_frame()) {
+			PHYSICS_INTERPOLATION_WARNING("MultiMesh interpolation is being triggered from outside physics process, this might lead to issues");
+		}
+#endif
+
+		return;
+	}
+
+	_multimesh_set_buffer_range(p_multimesh, p_from_instance, p_buffer);
+}
+
 RID RendererMeshStorage::multimesh_get_command_buffer_rd_rid(RID p_multimesh) const {
 	return _multimesh_get_command_buffer_rd_rid(p_multimesh);
 }
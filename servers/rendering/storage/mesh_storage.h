@@ -120,6 +120,18 @@ public:
 		Vector<float> _data_interpolated;
 	};
 
+	// Above this many separate runs of dirty regions, the whole visible buffer is uploaded instead.
+	static constexpr uint32_t MULTIMESH_MAX_DIRTY_RUNS = 64;
+
+	struct MultiMeshDirtyRun {
+		uint32_t from_region = 0;
+		uint32_t region_count = 0;
+	};
+
+	// Merges adjacent dirty regions into runs, so each run can be uploaded at once.
+	// p_previous_dirty_regions can be null. Returns -1 if there are more than MULTIMESH_MAX_DIRTY_RUNS runs.
+	static int multimesh_get_dirty_runs(const bool *p_dirty_regions, const bool *p_previous_dirty_regions, uint32_t p_region_count, MultiMeshDirtyRun *r_runs);
+
 	virtual RID multimesh_allocate();
 	virtual void multimesh_initialize(RID p_rid);
 	virtual void multimesh_free(RID p_rid);
@@ -145,6 +157,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer);
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer);
 	virtual RID multimesh_get_command_buffer_rd_rid(RID p_multimesh) const;
 	virtual RID multimesh_get_buffer_rd_rid(RID p_multimesh) const;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const;
@@ -184,6 +197,7 @@ public:
 	virtual Color _multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void _multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) = 0;
+	virtual void _multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) = 0;
 	virtual RID _multimesh_get_command_buffer_rd_rid(RID p_multimesh) const = 0;
 	virtual RID _multimesh_get_buffer_rd_rid(RID p_multimesh) const = 0;
 	virtual Vector<float> _multimesh_get_buffer(RID p_multimesh) const = 0;
@@ -214,6 +228,7 @@ public:
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) = 0;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) = 0;
 
 	virtual void skeleton_update_dependency(RID p_base, DependencyTracker *p_instance) = 0;
 
@@ -252,6 +252,9 @@ public:
 
 	virtual ShaderNativeSourceCode shader_get_native_source_code(RID p_shader) const = 0;
 
+	// Compiles all the shader variants the renderer currently needs and stores them in the shader cache. Returns the number of shader versions compiled.
+	virtual uint32_t shader_precompile_variants() = 0;
+
 	/* COMMON MATERIAL API */
 
 	enum {
@@ -501,6 +504,7 @@ public:
 	virtual Color multimesh_instance_get_custom_data(RID p_multimesh, int p_index) const = 0;
 
 	virtual void multimesh_set_buffer(RID p_multimesh, const Vector<float> &p_buffer) = 0;
+	virtual void multimesh_set_buffer_range(RID p_multimesh, int p_from_instance, const Vector<float> &p_buffer) = 0;
 	virtual RID multimesh_get_command_buffer_rd_rid(RID p_multimesh) const = 0;
 	virtual RID multimesh_get_buffer_rd_rid(RID p_multimesh) const = 0;
 	virtual Vector<float> multimesh_get_buffer(RID p_multimesh) const = 0;
@@ -524,6 +528,7 @@ public:
 	virtual void skeleton_bone_set_transform_2d(RID p_skeleton, int p_bone, const Transform2D &p_transform) = 0;
 	virtual Transform2D skeleton_bone_get_transform_2d(RID p_skeleton, int p_bone) const = 0;
 	virtual void skeleton_set_base_transform_2d(RID p_skeleton, const Transform2D &p_base_transform) = 0;
+	virtual void skeleton_set_buffer(RID p_skeleton, const Vector<float> &p_buffer) = 0;
 
 	/* Light API */
 
@@ -1796,6 +1801,8 @@ public:
 		RENDERING_INFO_PIPELINE_COMPILATIONS_SURFACE,
 		RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW,
 		RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION,
+		RENDERING_INFO_PIPELINE_COMPILATIONS_IN_FRAME,
+		RENDERING_INFO_PIPELINE_COMPILATION_STALL_TIME,
 		RENDERING_INFO_MAX
 	};
 
@@ -0,0 +1,222 @@
+/**************************************************************************/
+/*  test_json_stream.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/json.h"
+#include "core/io/json_stream.h"
+#include "core/io/stream_peer.h"
+
+#include "thirdparty/doctest/doctest.h"
+
+namespace TestJSONStream {
+
+static Ref<JSONStreamReader> _reader_for(const String &p_json, int p_chunk_size = 65536) {
+	// Read through a peer rather than `open_buffer()`, so the input is consumed in chunks.
+	Ref<StreamPeerBuffer> peer;
+	peer.instantiate();
+	peer->set_data_array(p_json.to_utf8_buffer());
+
+	Ref<JSONStreamReader> reader;
+	reader.instantiate();
+	reader->set_chunk_size(p_chunk_size);
+	reader->open_stream_peer(peer);
+	reader->finish_input();
+	return reader;
+}
+
+TEST_CASE("[JSONStreamReader] Events") {
+	Ref<JSONStreamReader> reader = _reader_for(R"({"a": [1, true, null], "b": "text"})");
+
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_OBJECT_BEGIN);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_KEY);
+	CHECK(reader->get_value() == "a");
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_ARRAY_BEGIN);
+	CHECK(reader->get_depth() == 2);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_VALUE);
+	CHECK(double(reader->get_value()) == 1.0);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == Variant(true));
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_VALUE);
+	CHECK(reader->get_value() == Variant());
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_ARRAY_END);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == "b");
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == "text");
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_OBJECT_END);
+	CHECK(reader->get_depth() == 0);
+	CHECK(reader->read() == ERR_FILE_EOF);
+	CHECK(reader->get_error_message().is_empty());
+}
+
+TEST_CASE("[JSONStreamReader] Matches JSON with tokens split across chunks") {
+	const String json_string = String::utf8(R"({"name": "café 😀 \"quoted\"", "values": [0.5, -12, 3e2], "nested": {"empty": [], "flag": false}})");
+
+	// A tiny chunk size forces every token to be resumed across refills.
+	Ref<JSONStreamReader> reader = _reader_for(json_string, 16);
+	CHECK(reader->read() == OK);
+	Variant streamed = reader->read_value();
+	CHECK(reader->read() == ERR_FILE_EOF);
+
+	CHECK(streamed == JSON::parse_string(json_string));
+	CHECK(Dictionary(streamed)["name"] == String::utf8("café 😀 \"quoted\""));
+}
+
+TEST_CASE("[JSONStreamReader] Skipping sections") {
+	Ref<JSONStreamReader> reader = _reader_for(R"([{"skip": [1, 2, {"deep": 3}]}, 42])");
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_OBJECT_BEGIN);
+	CHECK(reader->skip_section() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_OBJECT_END);
+	CHECK(reader->read() == OK);
+	CHECK(double(reader->get_value()) == 42.0);
+}
+
+TEST_CASE("[JSONStreamReader] Incremental input from a StreamPeer") {
+	Ref<StreamPeerBuffer> peer;
+	peer.instantiate();
+	Ref<JSONStreamReader> reader;
+	reader.instantiate();
+	reader->open_stream_peer(peer);
+
+	const CharString first = "[\"hel";
+	peer->put_data((const uint8_t *)first.get_data(), first.length());
+	peer->seek(0);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_ARRAY_BEGIN);
+	CHECK_MESSAGE(reader->read() == ERR_BUSY, "An incomplete string should wait for more input.");
+
+	const CharString second = "lo\"]";
+	int64_t pos = peer->get_position();
+	peer->seek(peer->get_size());
+	peer->put_data((const uint8_t *)second.get_data(), second.length());
+	peer->seek(pos);
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_value() == "hello");
+	CHECK(reader->read() == OK);
+	CHECK(reader->get_event_type() == JSONStreamReader::EVENT_ARRAY_END);
+	reader->finish_input();
+	CHECK(reader->read() == ERR_FILE_EOF);
+}
+
+TEST_CASE("[JSONStreamReader] Errors") {
+	Ref<JSONStreamReader> reader = _reader_for("[1, 2");
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_message() == "Expected ']'");
+
+	reader = _reader_for("{\"a\" 1}");
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_message() == "Expected ':'");
+
+	reader = _reader_for("\n\n[nope]");
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_current_line() == 3);
+
+	reader = _reader_for("1 2");
+	CHECK(reader->read() == OK);
+	CHECK(reader->read() == ERR_PARSE_ERROR);
+	CHECK(reader->get_error_message() == "Expected 'EOF'");
+}
+
+TEST_CASE("[JSONStreamWriter] Writing a document") {
+	Ref<JSONStreamWriter> writer;
+	writer.instantiate();
+	writer->open_buffer();
+	CHECK(writer->begin_object() == OK);
+	CHECK(writer->write_key("list") == OK);
+	CHECK(writer->begin_array() == OK);
+	CHECK(writer->write_value(1) == OK);
+	CHECK(writer->write_value(0.5) == OK);
+	CHECK(writer->write_value("line\n\"quote\"") == OK);
+	CHECK(writer->end_array() == OK);
+	CHECK(writer->write_key("dict") == OK);
+	Dictionary d;
+	d["x"] = Variant();
+	CHECK(writer->write_value(d) == OK);
+	CHECK(writer->end_object() == OK);
+	CHECK(writer->close() == OK);
+
+	const String output = String::utf8((const char *)writer->get_data().ptr(), writer->get_data().size());
+	CHECK(output == R"({"list":[1,0.5,"line\n\"quote\""],"dict":{"x":null}})");
+}
+
+TEST_CASE("[JSONStreamWriter] Invalid structure") {
+	Ref<JSONStreamWriter> writer;
+	writer.instantiate();
+	writer->open_buffer();
+	CHECK(writer->begin_object() == OK);
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(writer->write_value(1) != OK, "Object values need a key.");
+	CHECK_MESSAGE(writer->end_array() != OK, "An object can't be ended as an array.");
+	CHECK_MESSAGE(writer->close() != OK, "Closing an incomplete document should fail.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[JSONStreamWriter] Round trip through JSONStreamReader") {
+	Array records;
+	for (int i = 0; i < 200; i++) {
+		Dictionary record;
+		record["id"] = i;
+		record["name"] = vformat("record %d", i);
+		records.push_back(record);
+	}
+
+	Ref<JSONStreamWriter> writer;
+	writer.instantiate();
+	writer->set_indent("\t");
+	writer->open_buffer();
+	writer->write_value(records);
+	writer->close();
+
+	Ref<JSONStreamReader> reader;
+	reader.instantiate();
+	reader->open_buffer(writer->get_data());
+	CHECK(reader->read() == OK);
+	CHECK(reader->read_value() == JSON::parse_string(JSON::stringify(records)));
+}
+
+} // namespace TestJSONStream
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/io/marshalls.h"
+#include "core/variant/variant_utility.h"
 
 #include "tests/test_macros.h"
 
@@ -491,4 +492,200 @@ TEST_CASE("[Marshalls] Typed dictionary decoding") {
 	CHECK(dictionary[Variant(uint64_t(0x0f123456789abcdef))] == Variant(uint64_t(0x0f123456789abcdef)));
 }
 
+TEST_CASE("[Marshalls] Compact typed array encoding") {
+	int r_len;
+	Array array;
+	array.set_typed(Variant::INT, StringName(), Ref<Script>());
+	array.push_back(Variant(uint64_t(0x0f123456789abcdef)));
+	array.push_back(1);
+	uint8_t buffer[28];
+
+	CHECK(encode_variant(array, nullptr, r_len, false, 0, true) == OK);
+	CHECK_MESSAGE(r_len == 28, "Length == 4 bytes for header + 4 bytes for array type + 4 bytes for array size + 2 * 8 bytes for elements.");
+	CHECK(encode_variant(array, buffer, r_len, false, 0, true) == OK);
+	CHECK_MESSAGE(buffer[0] == 0x1c, "Variant::ARRAY");
+	CHECK_MESSAGE(buffer[1] == 0x01, "HEADER_DATA_FLAG_COMPACT_ENCODING");
+	CHECK_MESSAGE(buffer[2] == 0x31, "CONTAINER_TYPE_KIND_BUILTIN | HEADER_DATA_FLAG_COMPACT_ARRAY | HEADER_DATA_FLAG_COMPACT_ARRAY_64");
+	CHECK(buffer[3] == 0x00);
+	// Check array type.
+	CHECK_MESSAGE(buffer[4] == 0x02, "Variant::INT");
+	// Check array size.
+	CHECK(buffer[8] == 0x02);
+	// Check element values, which have no header.
+	CHECK(buffer[12] == 0xef);
+	CHECK(buffer[19] == 0xf1);
+	CHECK(buffer[20] == 0x01);
+	CHECK(buffer[27] == 0x00);
+
+	Variant variant;
+	CHECK(decode_variant(variant, buffer, 28, &r_len) == OK);
+	CHECK(r_len == 28);
+	Array decoded = variant;
+	CHECK(decoded.get_typed_builtin() == Variant::INT);
+	CHECK(decoded == array);
+}
+
+TEST_CASE("[Marshalls] Compact encoding keeps untyped containers unchanged") {
+	Array array;
+	array.push_back(1);
+	array.push_back("two");
+	Array callables;
+	callables.set_typed(Variant::CALLABLE, StringName(), Ref<Script>());
+	callables.push_back(Callable());
+	array.push_back(callables);
+
+	int len = 0;
+	int compact_len = 0;
+	CHECK(encode_variant(array, nullptr, len) == OK);
+	CHECK(encode_variant(array, nullptr, compact_len, false, 0, true) == OK);
+	CHECK(len == compact_len);
+}
+
+TEST_CASE("[Marshalls] Compact typed dictionary round trip") {
+	Dictionary dict;
+	dict.set_typed(Variant::STRING, StringName(), Ref<Script>(), Variant::VECTOR3, StringName(), Ref<Script>());
+	dict["a"] = Vector3(1, 2, 3);
+	dict["bc"] = Vector3(-4, 5.5, 0);
+
+	int len = 0;
+	int compact_len = 0;
+	CHECK(encode_variant(dict, nullptr, len) == OK);
+	CHECK(encode_variant(dict, nullptr, compact_len, false, 0, true) == OK);
+	CHECK_MESSAGE(compact_len == len - 2 * 2 * 4, "Keys and values have no header.");
+
+	Vector<uint8_t> buffer;
+	buffer.resize(compact_len);
+	CHECK(encode_variant(dict, buffer.ptrw(), compact_len, false, 0, true) == OK);
+
+	Variant variant;
+	int r_len;
+	CHECK(decode_variant(variant, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == compact_len);
+	Dictionary decoded = variant;
+	CHECK(decoded.get_typed_key_builtin() == Variant::STRING);
+	CHECK(decoded.get_typed_value_builtin() == Variant::VECTOR3);
+	CHECK(decoded == dict);
+}
+
+TEST_CASE("[Marshalls] Compact nested containers round trip") {
+	Array ints;
+	ints.set_typed(Variant::INT, StringName(), Ref<Script>());
+	ints.push_back(7);
+	ints.push_back(-3);
+	Array floats;
+	floats.set_typed(Variant::FLOAT, StringName(), Ref<Script>());
+	floats.push_back(0.25);
+	floats.push_back(1e300);
+	Dictionary dict;
+	dict.set_typed(Variant::INT, StringName(), Ref<Script>(), Variant::ARRAY, StringName(), Ref<Script>());
+	dict[1] = ints;
+	dict[2] = floats;
+	Array outer = { dict, "untyped", ints };
+
+	int len = 0;
+	CHECK(encode_variant(outer, nullptr, len, false, 0, true) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	CHECK(encode_variant(outer, buffer.ptrw(), len, false, 0, true) == OK);
+	CHECK_MESSAGE(buffer[1] == 0x00, "The untyped outer array has no compact flags.");
+
+	Variant variant;
+	int r_len;
+	CHECK(decode_variant(variant, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == len);
+	CHECK(variant == Variant(outer));
+	Dictionary decoded = Array(variant)[0];
+	CHECK(decoded.get_typed_key_builtin() == Variant::INT);
+	CHECK(Array(decoded[2]).get_typed_builtin() == Variant::FLOAT);
+	CHECK(Array(decoded[2])[1] == Variant(1e300));
+}
+
+TEST_CASE("[Marshalls] Compact flags without the encoding marker are rejected") {
+	Variant variant;
+	uint8_t buffer[] = {
+		0x1c, 0x00, 0x11, 0x00, // Variant::ARRAY, CONTAINER_TYPE_KIND_BUILTIN | HEADER_DATA_FLAG_COMPACT_ARRAY without HEADER_DATA_FLAG_COMPACT_ENCODING.
+		0x02, 0x00, 0x00, 0x00, // Array type (Variant::INT).
+		0x01, 0x00, 0x00, 0x00, // Array size.
+		0x05, 0x00, 0x00, 0x00, // Element value.
+	};
+	ERR_PRINT_OFF;
+	CHECK(decode_variant(variant, buffer, 16) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+
+	buffer[1] = 0x01;
+	CHECK(decode_variant(variant, buffer, 16) == OK);
+	CHECK(variant == Variant(Array({ 5 })));
+}
+
+TEST_CASE("[Marshalls] var_to_bytes keeps the legacy encoding") {
+	Array array;
+	array.set_typed(Variant::INT, StringName(), Ref<Script>());
+	array.push_back(1);
+	array.push_back(2);
+
+	const uint8_t expected[] = {
+		0x1c, 0x00, 0x01, 0x00, // Variant::ARRAY, CONTAINER_TYPE_KIND_BUILTIN
+		0x02, 0x00, 0x00, 0x00, // Array type (Variant::INT).
+		0x02, 0x00, 0x00, 0x00, // Array size.
+		0x02, 0x00, 0x00, 0x00, // Element header (Variant::INT).
+		0x01, 0x00, 0x00, 0x00, // Element value.
+		0x02, 0x00, 0x00, 0x00, // Element header (Variant::INT).
+		0x02, 0x00, 0x00, 0x00, // Element value.
+	};
+	const PackedByteArray bytes = VariantUtilityFunctions::var_to_bytes(array);
+	REQUIRE(bytes.size() == int(sizeof(expected)));
+	CHECK(memcmp(bytes.ptr(), expected, sizeof(expected)) == 0);
+	CHECK(VariantUtilityFunctions::var_to_bytes_with_objects(array) == bytes);
+	CHECK(VariantUtilityFunctions::bytes_to_var(bytes) == Variant(array));
+}
+
+TEST_CASE("[Marshalls] var_to_bytes_compact round trip") {
+	Dictionary dict;
+	dict.set_typed(Variant::STRING_NAME, StringName(), Ref<Script>(), Variant::VECTOR2I, StringName(), Ref<Script>());
+	dict[StringName("a")] = Vector2i(1, 2);
+	dict[StringName("b")] = Vector2i(-3, 4);
+
+	const PackedByteArray bytes = VariantUtilityFunctions::var_to_bytes_compact(dict);
+	REQUIRE(bytes.size() > 4);
+	CHECK_MESSAGE(bytes[1] == 0x01, "HEADER_DATA_FLAG_COMPACT_ENCODING");
+	CHECK(bytes.size() < VariantUtilityFunctions::var_to_bytes(dict).size());
+
+	const Variant decoded = VariantUtilityFunctions::bytes_to_var(bytes);
+	CHECK(decoded == Variant(dict));
+	CHECK(Dictionary(decoded).get_typed_value_builtin() == Variant::VECTOR2I);
+}
+
+TEST_CASE("[Marshalls] Packed array round trip") {
+	PackedInt64Array ints = { 1, -2, 0x0f123456789abcdef };
+	PackedFloat32Array floats = { 0.5, -1.25, 3.0 };
+	PackedColorArray colors = { Color(0.1, 0.2, 0.3, 0.4), Color(1, 0, 1, 1) };
+	Array array = { ints, floats, colors };
+
+	int len = 0;
+	CHECK(encode_variant(array, nullptr, len) == OK);
+	Vector<uint8_t> buffer;
+	buffer.resize(len);
+	CHECK(encode_variant(array, buffer.ptrw(), len) == OK);
+	// Encoding is little-endian.
+	CHECK(buffer[16] == 0x01);
+
+	Variant variant;
+	int r_len;
+	CHECK(decode_variant(variant, buffer.ptr(), buffer.size(), &r_len) == OK);
+	CHECK(r_len == len);
+	CHECK(variant == Variant(array));
+}
+
+TEST_CASE("[Marshalls] Array decoding rejects a count larger than the data") {
+	Variant variant;
+	ERR_PRINT_OFF;
+	uint8_t buffer[] = {
+		0x1c, 0x00, 0x00, 0x00, // Variant::ARRAY
+		0xff, 0xff, 0xff, 0x7f, // Array size.
+		0x00, 0x00, 0x00, 0x00, // Element type (Variant::NIL).
+	};
+	CHECK(decode_variant(variant, buffer, 12) == ERR_INVALID_DATA);
+	ERR_PRINT_ON;
+}
+
 } // namespace TestMarshalls
@@ -111,6 +111,36 @@ TEST_CASE("[PacketPeer][PacketPeerStream] Put a variant to peer") {
 	CHECK_EQ(String(spb->get_var()), godot_rules);
 }
 
+TEST_CASE("[PacketPeer][PacketPeerStream] Put and read a variant with compact encoding") {
+	Array array;
+	array.set_typed(Variant::INT, StringName(), Ref<Script>());
+	array.push_back(1);
+	array.push_back(int64_t(1) << 40);
+
+	Ref<StreamPeerBuffer> spb;
+	spb.instantiate();
+
+	Ref<PacketPeerStream> pps;
+	pps.instantiate();
+	pps->set_stream_peer(spb);
+
+	CHECK_FALSE(pps->is_compact_encoding());
+	CHECK_EQ(pps->put_var(array), Error::OK);
+	const int regular_size = spb->get_size();
+
+	pps->set_compact_encoding(true);
+	CHECK_EQ(pps->put_var(array), Error::OK);
+	CHECK_LT(spb->get_size() - regular_size, regular_size);
+
+	spb->seek(0);
+	Variant value;
+	CHECK_EQ(pps->get_var(value), Error::OK);
+	CHECK_EQ(Array(value), array);
+	CHECK_EQ(pps->get_var(value), Error::OK);
+	CHECK_EQ(Array(value), array);
+	CHECK_EQ(Array(value).get_typed_builtin(), Variant::INT);
+}
+
 TEST_CASE("[PacketPeer][PacketPeerStream] Put a variant to peer out of memory failure") {
 	String more_than_1mb = String("*").repeat(1024 + 1);
 
@@ -33,6 +33,7 @@
 #pragma once
 
 #include "core/io/file_access_pack.h"
+#include "core/io/pack_path_index.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 
@@ -118,4 +119,118 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+TEST_CASE("[PCKPacker] Path index") {
+	const uint8_t md5[16] = {};
+	Vector<PackPathIndex::Source> sources;
+	for (int i = 0; i < 1000; i++) {
+		PackPathIndex::Source src;
+		src.path = vformat("res://dir_%d/file_%d.tres", i % 17, i);
+		src.ofs = i * 64;
+		src.size = i;
+		src.md5 = md5;
+		sources.push_back(src);
+	}
+	PackPathIndex::Source removal;
+	removal.path = "removed.tres";
+	removal.md5 = md5;
+	removal.flags = PACK_FILE_REMOVAL;
+	sources.push_back(removal);
+
+	PackPathIndex index;
+	REQUIRE_MESSAGE(
+			index.load(PackPathIndex::build(sources)) == OK,
+			"The built path index should load successfully.");
+	CHECK_MESSAGE(
+			index.get_entry_count() == 1000,
+			"Removal entries shouldn't be indexed.");
+
+	for (int i = 0; i < 1000; i++) {
+		int64_t idx = index.find(String(vformat("dir_%d/file_%d.tres", i % 17, i)).md5_buffer().ptr());
+		REQUIRE(idx != -1);
+		CHECK(index.get_entry(idx).ofs == uint64_t(i * 64));
+		CHECK(index.get_entry(idx).size == uint64_t(i));
+		CHECK(index.get_entry_path(idx) == vformat("dir_%d/file_%d.tres", i % 17, i));
+	}
+
+	CHECK_MESSAGE(
+			index.find(String("dir_0/missing.tres").md5_buffer().ptr()) == -1,
+			"Paths that weren't packed shouldn't be found.");
+	CHECK_MESSAGE(
+			index.find(String("removed.tres").md5_buffer().ptr()) == -1,
+			"Removed paths shouldn't be found.");
+
+	Vector<uint8_t> corrupt = PackPathIndex::build(sources);
+	corrupt.resize(corrupt.size() - 1);
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(index.load(corrupt) != OK, "A truncated path index should be rejected.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[PCKPacker] PCK file stores a path index") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_with_index.pck");
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("version.py", base_dir.path_join("../version.py")) == OK);
+	REQUIRE(pck_packer.add_file("some/dir/icon.png", base_dir.path_join("../icon.png")) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(f.is_valid());
+	f->seek(20);
+	CHECK_MESSAGE(
+			(f->get_32() & PACK_PATH_INDEX),
+			"The PCK header should flag the path index.");
+	uint64_t file_base = f->get_64();
+	uint64_t index_ofs = f->get_64();
+	uint64_t index_size = f->get_64();
+	CHECK(index_ofs + index_size <= file_base);
+
+	f->seek(index_ofs);
+	PackPathIndex index;
+	REQUIRE(index.load(f->get_buffer(index_size)) == OK);
+	CHECK(index.get_entry_count() == 2);
+	int64_t idx = index.find(String("some/dir/icon.png").md5_buffer().ptr());
+	REQUIRE(idx != -1);
+	CHECK(index.get_entry(idx).size == uint64_t(FileAccess::get_file_as_bytes(base_dir.path_join("../icon.png")).size()));
+}
+TEST_CASE("[PCKPacker] Mount a PCK file and look up its files") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_mounted.pck");
+	const String base_dir = OS::get_singleton()->get_executable_path().get_base_dir();
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	REQUIRE(pck_packer.add_file("version.py", base_dir.path_join("../version.py")) == OK);
+	REQUIRE(pck_packer.add_file("some/dir/icon.png", base_dir.path_join("../icon.png")) == OK);
+	REQUIRE(pck_packer.flush() == OK);
+
+	SUBCASE("From the path index") {
+		// The header written by PCKPacker is used as is.
+	}
+
+	SUBCASE("From the directory when the path index is out of bounds") {
+		Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ_WRITE);
+		REQUIRE(f.is_valid());
+		f->seek(40); // Path index size.
+		f->store_64(f->get_length());
+	}
+
+	PackedData *packed_data = PackedData::get_singleton();
+	REQUIRE(packed_data);
+	ERR_PRINT_OFF;
+	const Error err = packed_data->add_pack(output_pck_path, false, 0);
+	ERR_PRINT_ON;
+	REQUIRE(err == OK);
+
+	CHECK(packed_data->has_path("res://version.py"));
+	CHECK(packed_data->has_path("res://some/dir/icon.png"));
+	CHECK_FALSE(packed_data->has_path("res://some/dir/missing.png"));
+
+	Ref<FileAccess> packed_file = packed_data->try_open_path("res://some/dir/icon.png");
+	REQUIRE(packed_file.is_valid());
+	const Vector<uint8_t> expected = FileAccess::get_file_as_bytes(base_dir.path_join("../icon.png"));
+	CHECK(packed_file->get_length() == uint64_t(expected.size()));
+	CHECK(packed_file->get_buffer(expected.size()) == expected);
+
+	packed_data->clear();
+}
 } // namespace TestPCKPacker
@@ -0,0 +1,173 @@
+/**************************************************************************/
+/*  test_resource_streamer.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/resource_saver.h"
+#include "core/io/resource_streamer.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestResourceStreamer {
+
+static void wait_until_finished(ResourceStreamer *p_streamer, int64_t p_id) {
+	for (int i = 0; i < 5000; i++) {
+		p_streamer->poll();
+		ResourceStreamer::Status status = p_streamer->get_status(p_id);
+		if (status != ResourceStreamer::STATUS_QUEUED && status != ResourceStreamer::STATUS_LOADING) {
+			return;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+}
+
+TEST_CASE("[ResourceStreamer] Priorities and cancellation") {
+	ResourceStreamer *streamer = ResourceStreamer::get_singleton();
+	REQUIRE(streamer);
+
+	Vector<String> paths;
+	for (int i = 0; i < 3; i++) {
+		Ref<Resource> resource;
+		resource.instantiate();
+		resource->set_name(vformat("Streamed %d", i));
+		paths.push_back(TestUtils::get_temp_path(vformat("streamed_%d.tres", i)));
+		REQUIRE(ResourceSaver::save(resource, paths[i]) == OK);
+	}
+
+	const int max_concurrent_loads = streamer->get_max_concurrent_loads();
+	streamer->set_max_concurrent_loads(1);
+
+	const int64_t first = streamer->request(paths[0], "", 0, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	const int64_t low = streamer->request(paths[1], "", 0, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	const int64_t high = streamer->request(paths[2], "", 0, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	streamer->set_priority(high, 5);
+
+	CHECK(streamer->get_status(first) == ResourceStreamer::STATUS_LOADING);
+	CHECK(streamer->get_status(low) == ResourceStreamer::STATUS_QUEUED);
+	CHECK(streamer->get_status(high) == ResourceStreamer::STATUS_QUEUED);
+	CHECK(streamer->get_priority(high) == 5);
+	CHECK(streamer->get_loading_count() == 1);
+	CHECK(streamer->get_queued_count() == 2);
+
+	wait_until_finished(streamer, first);
+	CHECK(streamer->get_status(first) == ResourceStreamer::STATUS_LOADED);
+	CHECK_MESSAGE(streamer->get_status(high) != ResourceStreamer::STATUS_QUEUED, "The request with the highest priority should start next.");
+	CHECK(streamer->get_status(low) == ResourceStreamer::STATUS_QUEUED);
+
+	streamer->cancel(low);
+	CHECK(streamer->get_status(low) == ResourceStreamer::STATUS_INVALID);
+	CHECK(streamer->get_queued_count() == 0);
+
+	wait_until_finished(streamer, high);
+	REQUIRE(streamer->get_status(high) == ResourceStreamer::STATUS_LOADED);
+	CHECK(streamer->get_progress(high) == 1.0);
+	Ref<Resource> loaded = streamer->get_resource(high);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->get_name() == "Streamed 2");
+	CHECK_MESSAGE(streamer->get_status(high) == ResourceStreamer::STATUS_INVALID, "Retrieving the resource should release the request.");
+
+	CHECK(streamer->get_resource(first).is_valid());
+	CHECK(streamer->get_loading_count() == 0);
+
+	streamer->set_max_concurrent_loads(max_concurrent_loads);
+}
+
+TEST_CASE("[ResourceStreamer] Queue order") {
+	ResourceStreamer *streamer = ResourceStreamer::get_singleton();
+	REQUIRE(streamer);
+
+	Vector<String> paths;
+	for (int i = 0; i < 9; i++) {
+		Ref<Resource> resource;
+		resource.instantiate();
+		paths.push_back(TestUtils::get_temp_path(vformat("streamed_queue_%d.tres", i)));
+		REQUIRE(ResourceSaver::save(resource, paths[i]) == OK);
+	}
+
+	const int max_concurrent_loads = streamer->get_max_concurrent_loads();
+	streamer->set_max_concurrent_loads(1);
+
+	// Keeps the only load slot taken while the queue is set up.
+	const int64_t blocker = streamer->request(paths[8], "", 0, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(streamer->get_status(blocker) == ResourceStreamer::STATUS_LOADING);
+
+	const int priorities[8] = { 3, 1, 4, 1, 5, 9, 2, 6 };
+	int64_t ids[8];
+	for (int i = 0; i < 8; i++) {
+		ids[i] = streamer->request(paths[i], "", priorities[i], ResourceFormatLoader::CACHE_MODE_IGNORE);
+	}
+
+	// Reprioritized and canceled requests leave stale entries in the queue, which must be skipped.
+	streamer->set_priority(ids[5], 0);
+	streamer->set_priority(ids[1], 7);
+	streamer->set_priority(ids[1], 8);
+	streamer->cancel(ids[7]);
+	CHECK(streamer->get_queued_count() == 7);
+
+	// Highest priority first, requests with the same priority in the order they were made.
+	const int expected_order[7] = { 1, 4, 2, 0, 6, 3, 5 };
+	int64_t previous = blocker;
+	for (int i = 0; i < 7; i++) {
+		wait_until_finished(streamer, previous);
+		CHECK(streamer->get_status(previous) == ResourceStreamer::STATUS_LOADED);
+		streamer->get_resource(previous);
+
+		CHECK_MESSAGE(streamer->get_status(ids[expected_order[i]]) != ResourceStreamer::STATUS_QUEUED, vformat("Request %d should have started.", expected_order[i]));
+		CHECK(streamer->get_queued_count() == 6 - i);
+		previous = ids[expected_order[i]];
+	}
+
+	wait_until_finished(streamer, previous);
+	CHECK(streamer->get_status(previous) == ResourceStreamer::STATUS_LOADED);
+	streamer->get_resource(previous);
+	CHECK(streamer->get_loading_count() == 0);
+
+	streamer->set_max_concurrent_loads(max_concurrent_loads);
+}
+
+TEST_CASE("[ResourceStreamer] Missing resource") {
+	ResourceStreamer *streamer = ResourceStreamer::get_singleton();
+	REQUIRE(streamer);
+
+	ERR_PRINT_OFF;
+	const int64_t id = streamer->request(TestUtils::get_temp_path("does_not_exist.tres"));
+	wait_until_finished(streamer, id);
+	ERR_PRINT_ON;
+
+	CHECK(streamer->get_status(id) == ResourceStreamer::STATUS_FAILED);
+	CHECK(streamer->get_resource(id).is_null());
+	CHECK(streamer->get_status(id) == ResourceStreamer::STATUS_INVALID);
+}
+
+} // namespace TestResourceStreamer
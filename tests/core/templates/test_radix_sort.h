@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  test_radix_sort.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_pcg.h"
+#include "core/templates/radix_sort.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRadixSort {
+
+typedef RadixSort<uint32_t>::Element Element;
+
+static bool is_sorted_and_stable(const LocalVector<Element> &p_elements) {
+	for (uint32_t i = 1; i < p_elements.size(); i++) {
+		if (p_elements[i - 1].key > p_elements[i].key) {
+			return false;
+		}
+		// Values hold the original index, so equal keys must keep ascending values.
+		if (p_elements[i - 1].key == p_elements[i].key && p_elements[i - 1].value > p_elements[i].value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+TEST_CASE("[RadixSort] Sort random keys") {
+	RandomPCG rng(1234);
+	LocalVector<Element> elements;
+	elements.resize(5000);
+	for (uint32_t i = 0; i < elements.size(); i++) {
+		elements[i].key = (uint64_t(rng.rand()) << 32) | rng.rand();
+		elements[i].value = i;
+	}
+
+	RadixSort<uint32_t> sorter;
+	sorter.sort(elements.ptr(), elements.size());
+
+	CHECK_MESSAGE(is_sorted_and_stable(elements), "Elements should be sorted by key.");
+}
+
+TEST_CASE("[RadixSort] Stable with duplicate keys and few differing digits") {
+	RandomPCG rng(42);
+	LocalVector<Element> elements;
+	elements.resize(3000);
+	for (uint32_t i = 0; i < elements.size(); i++) {
+		// Only the second digit varies, so all other passes are skipped.
+		elements[i].key = 0xFF00000000000000ULL | (uint64_t(rng.rand() % 7) << 8);
+		elements[i].value = i;
+	}
+
+	RadixSort<uint32_t> sorter;
+	sorter.sort(elements.ptr(), elements.size());
+
+	CHECK_MESSAGE(is_sorted_and_stable(elements), "Elements with equal keys should keep their order.");
+
+	// Already sorted and equal keys must be left untouched.
+	for (uint32_t i = 0; i < elements.size(); i++) {
+		elements[i].key = 5;
+		elements[i].value = i;
+	}
+	sorter.sort(elements.ptr(), elements.size());
+	CHECK_MESSAGE(is_sorted_and_stable(elements), "Equal keys should be left in their original order.");
+}
+
+TEST_CASE("[RadixSort] Sort by a 128-bit key with two passes") {
+	RandomPCG rng(7);
+	const uint32_t size = 2000;
+	LocalVector<uint64_t> low;
+	LocalVector<uint64_t> high;
+	low.resize(size);
+	high.resize(size);
+	LocalVector<Element> elements;
+	elements.resize(size);
+	for (uint32_t i = 0; i < size; i++) {
+		low[i] = rng.rand() % 100;
+		high[i] = rng.rand() % 10;
+		elements[i].key = low[i];
+		elements[i].value = i;
+	}
+
+	RadixSort<uint32_t> sorter;
+	sorter.sort(elements.ptr(), size);
+	for (uint32_t i = 0; i < size; i++) {
+		elements[i].key = high[elements[i].value];
+	}
+	sorter.sort(elements.ptr(), size);
+
+	bool sorted = true;
+	for (uint32_t i = 1; i < size; i++) {
+		const uint32_t a = elements[i - 1].value;
+		const uint32_t b = elements[i].value;
+		if (high[a] > high[b] || (high[a] == high[b] && low[a] > low[b])) {
+			sorted = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(sorted, "Elements should be sorted by the high key, then by the low key.");
+}
+
+TEST_CASE("[RadixSort] Parallel sort matches serial sort") {
+	RandomPCG rng(99);
+	LocalVector<Element> parallel;
+	parallel.resize(RadixSort<uint32_t>::PARALLEL_MIN_ELEMENTS_PER_TASK * 4 + 123);
+	for (uint32_t i = 0; i < parallel.size(); i++) {
+		parallel[i].key = rng.rand() % 5000;
+		parallel[i].value = i;
+	}
+	LocalVector<Element> serial = parallel;
+
+	RadixSort<uint32_t> sorter;
+	sorter.sort(parallel.ptr(), parallel.size(), true);
+	sorter.sort(serial.ptr(), serial.size(), false);
+
+	CHECK_MESSAGE(is_sorted_and_stable(parallel), "Parallel sort should be sorted and stable.");
+
+	bool match = true;
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		if (serial[i].key != parallel[i].key || serial[i].value != parallel[i].value) {
+			match = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(match, "Parallel and serial sorts should give the same result.");
+}
+
+} // namespace TestRadixSort
@@ -32,10 +32,12 @@
 
 #pragma once
 
+#include "core/io/file_access.h"
 #include "core/variant/variant.h"
 #include "core/variant/variant_parser.h"
 
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestVariant {
 
@@ -1825,6 +1827,36 @@ TEST_CASE("[Variant] Writer and parser dictionary") {
 	CHECK_MESSAGE(d_parsed == Variant(d), "Should parse back.");
 }
 
+TEST_CASE("[Variant] Writer and parser packed arrays and strings") {
+	Array a = build_array(PackedInt32Array({ 1, -2, 3 }), PackedFloat64Array({ 0.5, -1e20 }), PackedByteArray({ 0, 255 }), String::utf8("ascii, ünïcödé"), StringName("name"));
+	String a_str;
+	VariantWriter::write_to_string(a, a_str);
+
+	VariantParser::StreamString ss;
+	String errs;
+	int line;
+	Variant a_parsed;
+
+	ss.s = a_str;
+	CHECK(VariantParser::parse(&ss, a_parsed, errs, line) == OK);
+	CHECK_MESSAGE(a_parsed == Variant(a), "Should parse back.");
+
+	// Files are read as UTF-8 bytes.
+	const String path = TestUtils::get_temp_path("variant_parser.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_string(a_str);
+	}
+
+	VariantParser::StreamFile sf;
+	sf.f = FileAccess::open(path, FileAccess::READ);
+	REQUIRE(sf.f.is_valid());
+	Variant f_parsed;
+	CHECK(VariantParser::parse(&sf, f_parsed, errs, line) == OK);
+	CHECK_MESSAGE(f_parsed == Variant(a), "Should parse back from a file.");
+}
+
 TEST_CASE("[Variant] Writer key sorting") {
 	Dictionary d = build_dictionary(StringName("C"), 3, "A", 1, StringName("B"), 2, "D", 4);
 	String d_str;
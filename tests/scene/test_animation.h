@@ -310,4 +310,79 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Bulk sampling of compressed tracks") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Enemy"));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(rotation_track, NodePath("Enemy"));
+	const int scale_track = animation->add_track(Animation::TYPE_SCALE_3D);
+	animation->track_set_path(scale_track, NodePath("Enemy"));
+	const int blend_shape_track = animation->add_track(Animation::TYPE_BLEND_SHAPE);
+	animation->track_set_path(blend_shape_track, NodePath("Enemy:Smile"));
+	const int value_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(value_track, NodePath("Enemy:modulate"));
+	animation->track_insert_key(value_track, 0.0, Color(1, 1, 1));
+
+	for (int i = 0; i <= 8; i++) {
+		const double time = i * 0.25;
+		animation->position_track_insert_key(position_track, time, Vector3(i, Math::sin(time), -2.0 * i));
+		animation->rotation_track_insert_key(rotation_track, time, Quaternion(Vector3(0, 1, 0), time));
+		animation->scale_track_insert_key(scale_track, time, Vector3(1, 1, 1) * (1.0 + time));
+		animation->blend_shape_track_insert_key(blend_shape_track, time, Math::cos(time));
+	}
+
+	Animation::CompressedSamples samples;
+	CHECK_FALSE(animation->sample_compressed_tracks(0.5, samples));
+
+	animation->compress();
+	REQUIRE(animation->track_is_compressed(position_track));
+
+	for (const double time : { 0.0, 0.1, 0.25, 0.6, 1.33, 1.9, 2.0, 3.0 }) {
+		CAPTURE(time);
+		REQUIRE(animation->sample_compressed_tracks(time, samples));
+
+		Vector3 position;
+		CHECK(samples.get_vector3(position_track, position));
+		CHECK(position.is_equal_approx(animation->position_track_interpolate(position_track, time)));
+
+		Quaternion rotation;
+		CHECK(samples.get_quaternion(rotation_track, rotation));
+		CHECK(rotation.is_equal_approx(animation->rotation_track_interpolate(rotation_track, time)));
+
+		Vector3 scale;
+		CHECK(samples.get_vector3(scale_track, scale));
+		CHECK(scale.is_equal_approx(animation->scale_track_interpolate(scale_track, time)));
+
+		float blend;
+		CHECK(samples.get_blend_shape(blend_shape_track, blend));
+		CHECK(blend == doctest::Approx(animation->blend_shape_track_interpolate(blend_shape_track, time)));
+
+		// Tracks of other types are not sampled.
+		CHECK_FALSE(samples.get_vector3(value_track, position));
+		CHECK_FALSE(samples.get_quaternion(position_track, rotation));
+	}
+
+	SUBCASE("Only the requested tracks are sampled") {
+		LocalVector<int32_t> requested;
+		requested.push_back(scale_track);
+		requested.push_back(rotation_track);
+		REQUIRE(animation->sample_compressed_tracks(0.6, samples, &requested));
+
+		Quaternion rotation;
+		CHECK(samples.get_quaternion(rotation_track, rotation));
+		CHECK(rotation.is_equal_approx(animation->rotation_track_interpolate(rotation_track, 0.6)));
+
+		Vector3 scale;
+		CHECK(samples.get_vector3(scale_track, scale));
+		CHECK(scale.is_equal_approx(animation->scale_track_interpolate(scale_track, 0.6)));
+
+		Vector3 position;
+		CHECK_FALSE(samples.get_vector3(position_track, position));
+		float blend;
+		CHECK_FALSE(samples.get_blend_shape(blend_shape_track, blend));
+	}
+}
+
 } // namespace TestAnimation
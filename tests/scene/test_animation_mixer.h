@@ -0,0 +1,347 @@
+/**************************************************************************/
+/*  test_animation_mixer.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "scene/3d/camera_3d.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+class TestAnimationMixerInternalsAccessor {
+public:
+	static bool has_blend_thread_flag(AnimationMixer *p_mixer, const Ref<Animation> &p_animation, bool p_object_tracks) {
+		return p_mixer->_get_blend_thread_flags(p_animation) & (p_object_tracks ? AnimationMixer::BLEND_THREAD_FLAG_OBJECT_TRACKS : AnimationMixer::BLEND_THREAD_FLAG_DISCRETE_VALUE_TRACKS);
+	}
+};
+
+namespace TestAnimationMixer {
+
+// A character made of a skeleton with two bones, and an animation player moving them.
+// The "Bone" bone moves from 0 to 10 along X over one second, the "Finger" bone is keyed at (0, 1, 0).
+struct LODTestScene {
+	Camera3D *camera = nullptr;
+	Node3D *character = nullptr;
+	Skeleton3D *skeleton = nullptr;
+	AnimationPlayer *player = nullptr;
+	int bone = -1;
+	int finger = -1;
+
+	LODTestScene() {
+		Window *root = SceneTree::get_singleton()->get_root();
+
+		camera = memnew(Camera3D);
+		root->add_child(camera);
+		camera->make_current();
+
+		character = memnew(Node3D);
+		root->add_child(character);
+
+		skeleton = memnew(Skeleton3D);
+		skeleton->set_name("Skeleton");
+		bone = skeleton->add_bone("Bone");
+		finger = skeleton->add_bone("Finger");
+		character->add_child(skeleton);
+
+		Ref<Animation> animation;
+		animation.instantiate();
+		animation->set_length(1.0);
+		animation->set_loop_mode(Animation::LOOP_LINEAR);
+		animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(0, NodePath("Skeleton:Bone"));
+		animation->position_track_insert_key(0, 0.0, Vector3(0, 0, 0));
+		animation->position_track_insert_key(0, 1.0, Vector3(10, 0, 0));
+		animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(1, NodePath("Skeleton:Finger"));
+		animation->position_track_insert_key(1, 0.0, Vector3(0, 1, 0));
+
+		Ref<AnimationLibrary> library;
+		library.instantiate();
+		library->add_animation("move", animation);
+
+		player = memnew(AnimationPlayer);
+		character->add_child(player);
+		player->add_animation_library("", library);
+		player->play("move");
+
+		// Start the playback before enabling the level of detail.
+		SceneTree::get_singleton()->process(0.1);
+
+		player->set_lod_distance_begin(10.0);
+		player->set_lod_distance_end(20.0);
+		player->set_lod_max_update_interval(4);
+		player->set_lod_reduced_tracks_distance(25.0);
+	}
+
+	~LODTestScene() {
+		memdelete(character);
+		memdelete(camera);
+	}
+
+	void set_distance(real_t p_distance) {
+		character->set_position(Vector3(0, 0, -p_distance));
+	}
+
+	double get_time() const {
+		return player->get_current_animation_position();
+	}
+
+	// Where the animation puts the moving bone at the given time.
+	Vector3 get_bone_target(double p_time) const {
+		return Vector3(10.0 * p_time, 0, 0);
+	}
+};
+
+TEST_CASE("[SceneTree][AnimationMixer] LOD update interval follows the distance to the camera") {
+	LODTestScene scene;
+	scene.player->set_lod_enabled(true);
+
+	scene.set_distance(5.0);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(scene.player->get_lod_update_interval() == 1);
+
+	// Halfway between the begin and end distances.
+	scene.set_distance(15.0);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(scene.player->get_lod_update_interval() == 3);
+
+	// The level is only chosen again once the next update happens.
+	scene.set_distance(30.0);
+	SceneTree::get_singleton()->process(0.1);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(scene.player->get_lod_update_interval() == 3);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(scene.player->get_lod_update_interval() == 4);
+
+	scene.player->set_lod_enabled(false);
+	CHECK(scene.player->get_lod_update_interval() == 1);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] LOD accumulates the delta of skipped frames") {
+	LODTestScene scene;
+	scene.player->set_lod_interpolate(false);
+	scene.player->set_lod_enabled(true);
+	scene.set_distance(30.0);
+
+	SceneTree::get_singleton()->process(0.1);
+	REQUIRE(scene.player->get_lod_update_interval() == 4);
+	double time = scene.get_time();
+	CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(scene.get_bone_target(time)));
+
+	// Skipped frames neither advance the playback nor touch the skeleton.
+	for (int i = 0; i < 3; i++) {
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(scene.get_time() == doctest::Approx(time));
+		CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(scene.get_bone_target(time)));
+	}
+
+	// The next update catches up with the time of the four frames.
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(scene.get_time() == doctest::Approx(time + 0.4));
+	CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(scene.get_bone_target(time + 0.4)));
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] LOD interpolates bone poses during skipped frames") {
+	LODTestScene scene;
+	scene.player->set_lod_enabled(true);
+	scene.set_distance(30.0);
+
+	Vector3 from = scene.skeleton->get_bone_pose_position(scene.bone);
+	SceneTree::get_singleton()->process(0.1);
+	REQUIRE(scene.player->get_lod_update_interval() == 4);
+	Vector3 target = scene.get_bone_target(scene.get_time());
+	REQUIRE_FALSE(from.is_equal_approx(target));
+
+	// The pose reaches the target over the update and the three skipped frames.
+	CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(from.lerp(target, 0.25)));
+	for (int i = 2; i <= 4; i++) {
+		SceneTree::get_singleton()->process(0.1);
+		CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(from.lerp(target, i * 0.25)));
+	}
+
+	// The next update starts again from the pose that was reached.
+	SceneTree::get_singleton()->process(0.1);
+	Vector3 next_target = scene.get_bone_target(scene.get_time());
+	CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(target.lerp(next_target, 0.25)));
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] LOD skips reduced tracks beyond their distance") {
+	LODTestScene scene;
+	scene.player->set_lod_interpolate(false);
+	TypedArray<NodePath> reduced_tracks;
+	reduced_tracks.push_back(NodePath("Skeleton:Finger"));
+	scene.player->set_lod_reduced_tracks(reduced_tracks);
+	scene.player->set_lod_enabled(true);
+
+	// Reduced tracks keep their last pose.
+	scene.skeleton->set_bone_pose_position(scene.finger, Vector3());
+	scene.set_distance(30.0);
+	SceneTree::get_singleton()->process(0.1);
+	CHECK(scene.skeleton->get_bone_pose_position(scene.finger).is_equal_approx(Vector3()));
+	CHECK(scene.skeleton->get_bone_pose_position(scene.bone).is_equal_approx(scene.get_bone_target(scene.get_time())));
+
+	// Closer than the reduced tracks distance, they are animated again from the next update.
+	scene.set_distance(15.0);
+	for (int i = 0; i < 4; i++) {
+		SceneTree::get_singleton()->process(0.1);
+	}
+	CHECK(scene.skeleton->get_bone_pose_position(scene.finger).is_equal_approx(Vector3(0, 1, 0)));
+}
+
+// A skeleton with one bone animated in position, rotation and scale, and the skeleton itself moved by a value track.
+struct BlendTestCharacter {
+	Node3D *character = nullptr;
+	Skeleton3D *skeleton = nullptr;
+	AnimationPlayer *player = nullptr;
+	Ref<Animation> animation;
+
+	BlendTestCharacter(Node *p_parent, double p_speed_scale) {
+		character = memnew(Node3D);
+		p_parent->add_child(character);
+
+		skeleton = memnew(Skeleton3D);
+		skeleton->set_name("Skeleton");
+		skeleton->add_bone("Bone");
+		character->add_child(skeleton);
+
+		animation.instantiate();
+		animation->set_length(1.0);
+		animation->set_loop_mode(Animation::LOOP_PINGPONG);
+		animation->add_track(Animation::TYPE_POSITION_3D);
+		animation->track_set_path(0, NodePath("Skeleton:Bone"));
+		animation->position_track_insert_key(0, 0.0, Vector3(0, 0, 0));
+		animation->position_track_insert_key(0, 1.0, Vector3(1, 2, 3));
+		animation->add_track(Animation::TYPE_ROTATION_3D);
+		animation->track_set_path(1, NodePath("Skeleton:Bone"));
+		animation->rotation_track_insert_key(1, 0.0, Quaternion());
+		animation->rotation_track_insert_key(1, 1.0, Quaternion(Vector3(0, 1, 0), Math::PI * 0.5));
+		animation->add_track(Animation::TYPE_SCALE_3D);
+		animation->track_set_path(2, NodePath("Skeleton:Bone"));
+		animation->scale_track_insert_key(2, 0.0, Vector3(1, 1, 1));
+		animation->scale_track_insert_key(2, 1.0, Vector3(2, 2, 2));
+		animation->add_track(Animation::TYPE_VALUE);
+		animation->track_set_path(3, NodePath("Skeleton:position"));
+		animation->track_insert_key(3, 0.0, Vector3(0, 0, 0));
+		animation->track_insert_key(3, 1.0, Vector3(0, 5, 0));
+
+		Ref<AnimationLibrary> library;
+		library.instantiate();
+		library->add_animation("blend", animation);
+
+		player = memnew(AnimationPlayer);
+		character->add_child(player);
+		player->add_animation_library("", library);
+		player->set_speed_scale(p_speed_scale);
+		player->play("blend");
+	}
+
+	~BlendTestCharacter() {
+		memdelete(character);
+	}
+};
+
+struct BlendTestResult {
+	Vector3 position;
+	Quaternion rotation;
+	Vector3 scale;
+	Vector3 skeleton_position;
+};
+
+LocalVector<BlendTestResult> run_blend_test(bool p_parallel_blending) {
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/parallel_blending", p_parallel_blending);
+
+	LocalVector<BlendTestCharacter *> characters;
+	for (int i = 0; i < 4; i++) {
+		characters.push_back(memnew(BlendTestCharacter(SceneTree::get_singleton()->get_root(), 1.0 + i * 0.3)));
+	}
+
+	// The batch of parallel mixers is flushed at the end of each frame.
+	for (int i = 0; i < 20; i++) {
+		SceneTree::get_singleton()->process(0.05);
+	}
+
+	LocalVector<BlendTestResult> results;
+	for (BlendTestCharacter *character : characters) {
+		BlendTestResult result;
+		result.position = character->skeleton->get_bone_pose_position(0);
+		result.rotation = character->skeleton->get_bone_pose_rotation(0);
+		result.scale = character->skeleton->get_bone_pose_scale(0);
+		result.skeleton_position = character->skeleton->get_position();
+		results.push_back(result);
+		memdelete(character);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/parallel_blending", false);
+	return results;
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Parallel blending gives the same results as serial blending") {
+	LocalVector<BlendTestResult> serial_results = run_blend_test(false);
+	LocalVector<BlendTestResult> parallel_results = run_blend_test(true);
+
+	REQUIRE(serial_results.size() == parallel_results.size());
+	for (uint32_t i = 0; i < serial_results.size(); i++) {
+		CHECK(serial_results[i].position.is_equal_approx(parallel_results[i].position));
+		CHECK(serial_results[i].rotation.is_equal_approx(parallel_results[i].rotation));
+		CHECK(serial_results[i].scale.is_equal_approx(parallel_results[i].scale));
+		CHECK(serial_results[i].skeleton_position.is_equal_approx(parallel_results[i].skeleton_position));
+		// Make sure the animation actually played.
+		CHECK_FALSE(serial_results[i].position.is_equal_approx(Vector3()));
+	}
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Tracks preventing parallel blending are cached until the animation changes") {
+	BlendTestCharacter character(SceneTree::get_singleton()->get_root(), 1.0);
+	AnimationPlayer *player = character.player;
+	Ref<Animation> animation = character.animation;
+
+	CHECK_FALSE(TestAnimationMixerInternalsAccessor::has_blend_thread_flag(player, animation, true));
+	CHECK_FALSE(TestAnimationMixerInternalsAccessor::has_blend_thread_flag(player, animation, false));
+
+	int method_track = animation->add_track(Animation::TYPE_METHOD);
+	animation->track_set_path(method_track, NodePath("Skeleton"));
+	CHECK(TestAnimationMixerInternalsAccessor::has_blend_thread_flag(player, animation, true));
+
+	animation->track_set_enabled(method_track, false);
+	CHECK_FALSE(TestAnimationMixerInternalsAccessor::has_blend_thread_flag(player, animation, true));
+
+	animation->value_track_set_update_mode(3, Animation::UPDATE_DISCRETE);
+	CHECK(TestAnimationMixerInternalsAccessor::has_blend_thread_flag(player, animation, false));
+
+	animation->value_track_set_update_mode(3, Animation::UPDATE_CONTINUOUS);
+	CHECK_FALSE(TestAnimationMixerInternalsAccessor::has_blend_thread_flag(player, animation, false));
+}
+
+} // namespace TestAnimationMixer
@@ -218,4 +218,49 @@ TEST_CASE("[Audio][AudioStreamWAV] Saving IMA ADPCM is not supported") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Audio][AudioStreamWAV] Skipping matches mixing") {
+	Ref<AudioStreamWAV> stream = memnew(AudioStreamWAV);
+	stream->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	stream->set_data(gen_pcm16_test(WAV_RATE, WAV_COUNT, false));
+
+	Ref<AudioStreamPlayback> mixed_playback = stream->instantiate_playback();
+	Ref<AudioStreamPlayback> skipped_playback = stream->instantiate_playback();
+	mixed_playback->start();
+	skipped_playback->start();
+
+	constexpr int BLOCK_SIZE = 512;
+	Vector<AudioFrame> mixed;
+	mixed.resize(BLOCK_SIZE);
+	Vector<AudioFrame> resumed;
+	resumed.resize(BLOCK_SIZE);
+
+	for (int i = 0; i < 16; i++) {
+		CHECK(mixed_playback->mix(mixed.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+		CHECK(skipped_playback->skip(1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	}
+
+	CHECK(mixed_playback->mix(mixed.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(skipped_playback->mix(resumed.ptrw(), 1.0, BLOCK_SIZE) == BLOCK_SIZE);
+	CHECK(skipped_playback->get_playback_position() == doctest::Approx(mixed_playback->get_playback_position()));
+
+	// The interpolation history is lost when skipping, only the first few frames may differ.
+	bool same_audio = true;
+	for (int i = 4; i < BLOCK_SIZE; i++) {
+		same_audio = same_audio && Math::is_equal_approx(mixed[i].left, resumed[i].left);
+	}
+	CHECK(same_audio);
+
+	SUBCASE("Skipping past the end stops the playback") {
+		int skipped = 0;
+		for (int i = 0; i < WAV_COUNT / BLOCK_SIZE + 4; i++) {
+			skipped = skipped_playback->skip(1.0, BLOCK_SIZE);
+			if (skipped != BLOCK_SIZE) {
+				break;
+			}
+		}
+		CHECK(skipped < BLOCK_SIZE);
+		CHECK_FALSE(skipped_playback->is_playing());
+	}
+}
+
 } // namespace TestAudioStreamWAV
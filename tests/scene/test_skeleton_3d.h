@@ -35,6 +35,8 @@
 #include "tests/test_macros.h"
 
 #include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+#include "scene/resources/3d/skin.h"
 
 namespace TestSkeleton3D {
 
@@ -74,4 +76,52 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+TEST_CASE("[Skeleton3D][SceneTree] Skin transforms uploaded in bulk match the per-bone path") {
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->add_bone("root");
+	skeleton->add_bone("child");
+	skeleton->add_bone("tip");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_bone_parent(2, 1);
+	skeleton->set_bone_rest(0, Transform3D(Basis(), Vector3(0, 1, 0)));
+	skeleton->set_bone_rest(1, Transform3D(Basis(Vector3(0, 0, 1), Math::PI / 4), Vector3(0, 0.5, 0)));
+	skeleton->set_bone_rest(2, Transform3D(Basis(), Vector3(0.25, 0.5, 0)));
+	skeleton->reset_bone_poses();
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+
+	Ref<Skin> skin;
+	skin.instantiate();
+	skin->add_bind(0, Transform3D(Basis(), Vector3(0, -1, 0)));
+	skin->add_named_bind("tip", Transform3D(Basis(Vector3(1, 0, 0), Math::PI / 3), Vector3(0.1, -2, 0.3)));
+	skin->add_bind(1, Transform3D(Basis().scaled(Vector3(2, 2, 2)), Vector3()));
+	Ref<SkinReference> skin_reference = skeleton->register_skin(skin);
+	REQUIRE(skin_reference.is_valid());
+
+	skeleton->set_bone_pose_rotation(1, Quaternion(Vector3(0, 1, 0), Math::PI / 6));
+	skeleton->set_bone_pose_position(2, Vector3(0.25, 0.75, -0.5));
+	skeleton->notification(Skeleton3D::NOTIFICATION_UPDATE_SKELETON);
+
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const RID bulk_skeleton = skin_reference->get_skeleton();
+	REQUIRE_EQ(rs->skeleton_get_bone_count(bulk_skeleton), 3);
+
+	// Upload the same transforms one bone at a time, the way skins were updated before.
+	const int bind_bones[3] = { 0, 2, 1 };
+	const RID per_bone_skeleton = rs->skeleton_create();
+	rs->skeleton_allocate_data(per_bone_skeleton, 3);
+	for (int i = 0; i < 3; i++) {
+		rs->skeleton_bone_set_transform(per_bone_skeleton, i, skeleton->get_bone_global_pose(bind_bones[i]) * skin->get_bind_pose(i));
+	}
+
+	for (int i = 0; i < 3; i++) {
+		const Transform3D bulk_transform = rs->skeleton_bone_get_transform(bulk_skeleton, i);
+		CHECK_MESSAGE(bulk_transform == rs->skeleton_bone_get_transform(per_bone_skeleton, i), vformat("Bind #%d should match the per-bone upload.", i));
+		CHECK(bulk_transform.is_equal_approx(skeleton->get_bone_global_pose(bind_bones[i]) * skin->get_bind_pose(i)));
+	}
+
+	rs->free(per_bone_skeleton);
+	skin_reference.unref();
+	memdelete(skeleton);
+}
+
 } // namespace TestSkeleton3D
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*  test_mesh_storage.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/storage/mesh_storage.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMeshStorage {
+
+TEST_CASE("[MeshStorage] MultiMesh dirty regions are merged into runs") {
+	RendererMeshStorage::MultiMeshDirtyRun runs[RendererMeshStorage::MULTIMESH_MAX_DIRTY_RUNS];
+
+	SUBCASE("No dirty regions") {
+		const bool dirty[4] = { false, false, false, false };
+		CHECK(RendererMeshStorage::multimesh_get_dirty_runs(dirty, nullptr, 4, runs) == 0);
+	}
+
+	SUBCASE("Adjacent regions are merged") {
+		const bool dirty[8] = { true, true, false, true, true, true, false, true };
+		REQUIRE(RendererMeshStorage::multimesh_get_dirty_runs(dirty, nullptr, 8, runs) == 3);
+		CHECK(runs[0].from_region == 0);
+		CHECK(runs[0].region_count == 2);
+		CHECK(runs[1].from_region == 3);
+		CHECK(runs[1].region_count == 3);
+		CHECK(runs[2].from_region == 7);
+		CHECK(runs[2].region_count == 1);
+	}
+
+	SUBCASE("Regions dirty in the previous frame are included") {
+		const bool dirty[6] = { true, false, false, false, true, false };
+		const bool previous_dirty[6] = { false, true, false, true, false, false };
+		REQUIRE(RendererMeshStorage::multimesh_get_dirty_runs(dirty, previous_dirty, 6, runs) == 2);
+		CHECK(runs[0].from_region == 0);
+		CHECK(runs[0].region_count == 2);
+		CHECK(runs[1].from_region == 3);
+		CHECK(runs[1].region_count == 2);
+	}
+
+	SUBCASE("Regions past the region count are ignored") {
+		const bool dirty[4] = { false, true, true, true };
+		REQUIRE(RendererMeshStorage::multimesh_get_dirty_runs(dirty, nullptr, 2, runs) == 1);
+		CHECK(runs[0].from_region == 1);
+		CHECK(runs[0].region_count == 1);
+	}
+
+	SUBCASE("Too many runs") {
+		const uint32_t region_count = RendererMeshStorage::MULTIMESH_MAX_DIRTY_RUNS * 2 + 2;
+		bool dirty[region_count] = {};
+		for (uint32_t i = 0; i < RendererMeshStorage::MULTIMESH_MAX_DIRTY_RUNS; i++) {
+			dirty[i * 2] = true;
+		}
+		CHECK(RendererMeshStorage::multimesh_get_dirty_runs(dirty, nullptr, region_count, runs) == (int)RendererMeshStorage::MULTIMESH_MAX_DIRTY_RUNS);
+
+		dirty[region_count - 1] = true;
+		CHECK(RendererMeshStorage::multimesh_get_dirty_runs(dirty, nullptr, region_count, runs) == -1);
+	}
+}
+
+TEST_CASE("[SceneTree][MeshStorage] MultiMesh buffer ranges") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	RID multimesh = rs->multimesh_create();
+	rs->multimesh_allocate_data(multimesh, 4, RS::MULTIMESH_TRANSFORM_2D, true);
+
+	// 2D transforms with colors use 12 floats per instance.
+	const int stride = 12;
+
+	SUBCASE("Range before the buffer is set") {
+		Vector<float> range;
+		range.resize(stride);
+		for (int i = 0; i < stride; i++) {
+			range.write[i] = i + 1;
+		}
+		rs->multimesh_set_buffer_range(multimesh, 2, range);
+
+		Vector<float> buffer = rs->multimesh_get_buffer(multimesh);
+		REQUIRE(buffer.size() == 4 * stride);
+		for (int i = 0; i < 4 * stride; i++) {
+			CHECK(buffer[i] == (i >= 2 * stride && i < 3 * stride ? float(i - 2 * stride + 1) : 0.0f));
+		}
+	}
+
+	SUBCASE("Range over an existing buffer") {
+		Vector<float> full;
+		full.resize(4 * stride);
+		full.fill(-1.0);
+		rs->multimesh_set_buffer(multimesh, full);
+
+		Vector<float> range;
+		range.resize(2 * stride);
+		range.fill(5.0);
+		rs->multimesh_set_buffer_range(multimesh, 1, range);
+
+		Vector<float> buffer = rs->multimesh_get_buffer(multimesh);
+		REQUIRE(buffer.size() == 4 * stride);
+		for (int i = 0; i < 4 * stride; i++) {
+			CHECK(buffer[i] == (i >= stride && i < 3 * stride ? 5.0f : -1.0f));
+		}
+	}
+
+	SUBCASE("Invalid ranges are rejected") {
+		Vector<float> full;
+		full.resize(4 * stride);
+		full.fill(-1.0);
+		rs->multimesh_set_buffer(multimesh, full);
+
+		Vector<float> range;
+		range.resize(2 * stride);
+		range.fill(5.0);
+		ERR_PRINT_OFF;
+		rs->multimesh_set_buffer_range(multimesh, 3, range);
+		range.resize(stride + 1);
+		rs->multimesh_set_buffer_range(multimesh, 0, range);
+		ERR_PRINT_ON;
+
+		CHECK(rs->multimesh_get_buffer(multimesh) == full);
+	}
+
+	rs->free(multimesh);
+}
+
+} // namespace TestMeshStorage
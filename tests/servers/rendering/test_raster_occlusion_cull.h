@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/raster_occlusion_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRasterOcclusionCull {
+
+// Creating a backend replaces the occlusion culling singleton, this restores it afterwards.
+class SingletonRestorer : public RendererSceneOcclusionCull {
+public:
+	static void restore(RendererSceneOcclusionCull *p_singleton) {
+		singleton = p_singleton;
+	}
+};
+
+static bool is_box_occluded(const RendererSceneOcclusionCull::HZBuffer *p_buffer, const AABB &p_aabb, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	const real_t bounds[6] = {
+		p_aabb.position.x,
+		p_aabb.position.y,
+		p_aabb.position.z,
+		p_aabb.position.x + p_aabb.size.x,
+		p_aabb.position.y + p_aabb.size.y,
+		p_aabb.position.z + p_aabb.size.z,
+	};
+	uint64_t timeout = 0;
+	return p_buffer->is_occluded(bounds, p_cam_transform.origin, p_cam_transform.affine_inverse(), p_cam_projection, p_cam_projection.get_z_near(), timeout);
+}
+
+TEST_CASE("[RasterOcclusionCull] Occluder hides boxes behind it") {
+	RendererSceneOcclusionCull *previous_singleton = RendererSceneOcclusionCull::get_singleton();
+	RasterOcclusionCull *occlusion_cull = memnew(RasterOcclusionCull);
+
+	const RID scenario = RID::from_uint64(1);
+	const RID buffer = RID::from_uint64(2);
+	const RID instance = RID::from_uint64(3);
+
+	// 4x4 quad, facing the camera from 5 units away.
+	PackedVector3Array vertices = { Vector3(-2, -2, -5), Vector3(2, -2, -5), Vector3(2, 2, -5), Vector3(-2, 2, -5) };
+	PackedInt32Array indices = { 0, 1, 2, 0, 2, 3 };
+	RID occluder = occlusion_cull->occluder_allocate();
+	occlusion_cull->occluder_initialize(occluder);
+	occlusion_cull->occluder_set_mesh(occluder, vertices, indices);
+
+	occlusion_cull->add_scenario(scenario);
+	occlusion_cull->scenario_set_instance(scenario, instance, occluder, Transform3D(), true);
+	occlusion_cull->add_buffer(buffer);
+	occlusion_cull->buffer_set_scenario(buffer, scenario);
+	occlusion_cull->buffer_set_size(buffer, Size2i(64, 64));
+
+	Projection projection;
+	projection.set_perspective(90, 1.0, 0.1, 100.0);
+	const Transform3D cam_transform;
+	occlusion_cull->buffer_update(buffer, cam_transform, projection, false);
+
+	const RendererSceneOcclusionCull::HZBuffer *hz_buffer = occlusion_cull->buffer_get_ptr(buffer);
+	REQUIRE(hz_buffer != nullptr);
+
+	CHECK_MESSAGE(is_box_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -20.5), Vector3(1, 1, 1)), cam_transform, projection), "A box right behind the occluder should be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -2.5), Vector3(1, 1, 1)), cam_transform, projection), "A box in front of the occluder should not be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(hz_buffer, AABB(Vector3(13.5, -0.5, -20.5), Vector3(1, 1, 1)), cam_transform, projection), "A box behind the occluder, but outside its screen area, should not be occluded.");
+
+	// Disabled occluders don't occlude anything.
+	occlusion_cull->scenario_set_instance(scenario, instance, occluder, Transform3D(), false);
+	occlusion_cull->buffer_update(buffer, cam_transform, projection, false);
+	CHECK_MESSAGE(!is_box_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -20.5), Vector3(1, 1, 1)), cam_transform, projection), "Disabled occluders should not occlude.");
+
+	// Moving the occluder moves the occluded area.
+	occlusion_cull->scenario_set_instance(scenario, instance, occluder, Transform3D(Basis(), Vector3(14, 0, 0)), true);
+	occlusion_cull->buffer_update(buffer, cam_transform, projection, false);
+	CHECK_MESSAGE(!is_box_occluded(hz_buffer, AABB(Vector3(-0.5, -0.5, -20.5), Vector3(1, 1, 1)), cam_transform, projection), "The center should be visible once the occluder moved away.");
+
+	occlusion_cull->remove_buffer(buffer);
+	occlusion_cull->scenario_remove_instance(scenario, instance);
+	occlusion_cull->remove_scenario(scenario);
+	occlusion_cull->free_occluder(occluder);
+	memdelete(occlusion_cull);
+	SingletonRestorer::restore(previous_singleton);
+}
+
+} // namespace TestRasterOcclusionCull
@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "servers/rendering/renderer_scene_cull.h"
+
+#include "core/math/random_number_generator.h"
+#include "tests/test_macros.h"
+
+namespace TestRendererSceneCull {
+
+TEST_CASE("[RendererSceneCull] Block frustum masks match per-instance frustum tests") {
+	Projection projection;
+	projection.set_perspective(70, 16.0 / 9.0, 0.05, 100.0);
+	const RendererSceneCull::Frustum frustum(projection.get_projection_planes(Transform3D(Basis(), Vector3(0, 0, 10))));
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(20250101);
+
+	const uint32_t instance_count = 1000;
+	PagedArrayPool<RendererSceneCull::InstanceBounds> pool;
+	PagedArray<RendererSceneCull::InstanceBounds> instance_bounds;
+	instance_bounds.set_page_pool(&pool);
+	for (uint32_t i = 0; i < instance_count; i++) {
+		const Vector3 position(rng->randf_range(-150, 150), rng->randf_range(-150, 150), rng->randf_range(-150, 150));
+		const Vector3 size(rng->randf_range(0, 10), rng->randf_range(0, 10), rng->randf_range(0, 10));
+		instance_bounds.push_back(RendererSceneCull::InstanceBounds(AABB(position, size)));
+	}
+
+	// Start at an unaligned offset, so the last block is partial.
+	const uint64_t from = 7;
+	uint32_t inside_count = 0;
+	bool all_match = true;
+	RendererSceneCull::InstanceBoundsBlock block;
+	for (uint64_t block_from = from; block_from < instance_count; block_from += RendererSceneCull::InstanceBoundsBlock::SIZE) {
+		const uint32_t count = MIN(instance_count - block_from, uint64_t(RendererSceneCull::InstanceBoundsBlock::SIZE));
+		block.load(instance_bounds, block_from, count);
+		const uint64_t mask = block.in_frustum_mask(frustum);
+
+		for (uint32_t i = 0; i < count; i++) {
+			const bool expected = instance_bounds[block_from + i].in_frustum(frustum);
+			all_match = all_match && (expected == bool(mask & (uint64_t(1) << i)));
+			inside_count += expected ? 1 : 0;
+		}
+		if (count < RendererSceneCull::InstanceBoundsBlock::SIZE) {
+			CHECK_MESSAGE((mask >> count) == 0, "Unused lanes of a partial block must not be reported as inside.");
+		}
+	}
+
+	CHECK_MESSAGE(all_match, "Block frustum masks should match InstanceBounds::in_frustum() for every instance.");
+	CHECK_MESSAGE(inside_count > 0, "Some instances should be inside the frustum.");
+	CHECK_MESSAGE(inside_count < instance_count - from, "Some instances should be outside the frustum.");
+
+	instance_bounds.reset();
+	pool.reset();
+}
+
+} // namespace TestRendererSceneCull
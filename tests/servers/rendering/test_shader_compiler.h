@@ -0,0 +1,206 @@
+/**************************************************************************/
+/*  test_shader_compiler.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "servers/rendering/shader_compiler.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestShaderCompiler {
+
+static const char *test_shader_code = R"(
+shader_type spatial;
+render_mode unshaded, cull_disabled;
+
+uniform vec4 albedo : source_color = vec4(1.0, 0.5, 0.25, 1.0);
+uniform sampler2D albedo_texture : source_color;
+
+void fragment() {
+	ALBEDO = albedo.rgb * texture(albedo_texture, UV).rgb;
+	ALPHA = 0.5;
+}
+)";
+
+struct CompileResult {
+	Error err = FAILED;
+	ShaderCompiler::GeneratedCode gen_code;
+	HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	int cull_mode = RS::CULL_MODE_BACK;
+	bool unshaded = false;
+	bool uses_alpha = false;
+	bool uses_discard = false;
+};
+
+static void compile_test_shader(ShaderCompiler &p_compiler, CompileResult &r_result) {
+	ShaderCompiler::IdentifierActions actions;
+	actions.entry_point_stages["vertex"] = ShaderCompiler::STAGE_VERTEX;
+	actions.entry_point_stages["fragment"] = ShaderCompiler::STAGE_FRAGMENT;
+	actions.entry_point_stages["light"] = ShaderCompiler::STAGE_FRAGMENT;
+	actions.render_mode_values["cull_disabled"] = Pair<int *, int>(&r_result.cull_mode, RS::CULL_MODE_DISABLED);
+	actions.render_mode_values["cull_front"] = Pair<int *, int>(&r_result.cull_mode, RS::CULL_MODE_FRONT);
+	actions.render_mode_values["cull_back"] = Pair<int *, int>(&r_result.cull_mode, RS::CULL_MODE_BACK);
+	actions.render_mode_flags["unshaded"] = &r_result.unshaded;
+	actions.usage_flag_pointers["ALPHA"] = &r_result.uses_alpha;
+	actions.usage_flag_pointers["DISCARD"] = &r_result.uses_discard;
+	actions.uniforms = &r_result.uniforms;
+
+	r_result.err = p_compiler.compile(RS::SHADER_SPATIAL, test_shader_code, &actions, "", r_result.gen_code);
+}
+
+static void check_same_result(const CompileResult &p_a, const CompileResult &p_b) {
+	CHECK(p_a.err == p_b.err);
+	CHECK(p_a.cull_mode == p_b.cull_mode);
+	CHECK(p_a.unshaded == p_b.unshaded);
+	CHECK(p_a.uses_alpha == p_b.uses_alpha);
+	CHECK(p_a.uses_discard == p_b.uses_discard);
+	CHECK(p_a.gen_code.uniforms == p_b.gen_code.uniforms);
+	CHECK(p_a.gen_code.uniform_total_size == p_b.gen_code.uniform_total_size);
+	CHECK(p_a.gen_code.uniform_offsets == p_b.gen_code.uniform_offsets);
+	CHECK(p_a.gen_code.defines == p_b.gen_code.defines);
+	CHECK(p_a.gen_code.texture_uniforms.size() == p_b.gen_code.texture_uniforms.size());
+	CHECK(p_a.gen_code.code.size() == p_b.gen_code.code.size());
+	for (const KeyValue<String, String> &E : p_a.gen_code.code) {
+		const String *other = p_b.gen_code.code.getptr(E.key);
+		CHECK(other != nullptr);
+		if (other) {
+			CHECK(E.value == *other);
+		}
+	}
+	CHECK(p_a.uniforms.size() == p_b.uniforms.size());
+	for (const KeyValue<StringName, ShaderLanguage::ShaderNode::Uniform> &E : p_a.uniforms) {
+		const ShaderLanguage::ShaderNode::Uniform *other = p_b.uniforms.getptr(E.key);
+		CHECK(other != nullptr);
+		if (other) {
+			CHECK(E.value.type == other->type);
+			CHECK(E.value.order == other->order);
+			CHECK(E.value.hint == other->hint);
+			CHECK(E.value.default_value.size() == other->default_value.size());
+		}
+	}
+}
+
+TEST_CASE("[SceneTree][ShaderCompiler] Compiled shaders are cached on disk") {
+	const String cache_dir = TestUtils::get_temp_path("shader_compiler_cache");
+	DirAccess::make_dir_recursive_absolute(cache_dir);
+
+	ShaderCompiler compiler;
+	compiler.initialize(ShaderCompiler::DefaultIdentifierActions());
+
+	CompileResult uncached;
+	compile_test_shader(compiler, uncached);
+	REQUIRE(uncached.err == OK);
+	CHECK(uncached.cull_mode == RS::CULL_MODE_DISABLED);
+	CHECK(uncached.unshaded);
+	CHECK(uncached.uses_alpha);
+	CHECK_FALSE(uncached.uses_discard);
+	CHECK(uncached.uniforms.size() == 2);
+
+	ShaderCompiler::set_cache_dir(cache_dir);
+
+	// The first compile stores the result, the second one is loaded from the cache.
+	CompileResult stored;
+	compile_test_shader(compiler, stored);
+	check_same_result(uncached, stored);
+
+	Ref<DirAccess> da = DirAccess::open(cache_dir.path_join("ShaderCompiler"));
+	REQUIRE(da.is_valid());
+	CHECK(da->get_files().size() >= 1);
+
+	CompileResult loaded;
+	compile_test_shader(compiler, loaded);
+	check_same_result(uncached, loaded);
+
+	ShaderCompiler::set_cache_dir(String());
+}
+
+TEST_CASE("[ShaderCompiler] Old cache entries are removed above the maximum size") {
+	const String cache_dir = TestUtils::get_temp_path("shader_compiler_cache_cleanup");
+	const String compiler_cache_dir = cache_dir.path_join("ShaderCompiler");
+	DirAccess::make_dir_recursive_absolute(compiler_cache_dir);
+
+	Vector<uint8_t> data;
+	data.resize(1000);
+	data.fill(0);
+	for (int i = 0; i < 4; i++) {
+		Ref<FileAccess> f = FileAccess::open(compiler_cache_dir.path_join(vformat("entry_%d.cache", i)), FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(data);
+	}
+
+	// Without a maximum size, nothing is removed.
+	ShaderCompiler::set_cache_dir(cache_dir);
+	Ref<DirAccess> da = DirAccess::open(compiler_cache_dir);
+	REQUIRE(da.is_valid());
+	CHECK(da->get_files().size() == 4);
+
+	ShaderCompiler::set_cache_dir(cache_dir, 2500);
+	CHECK(da->get_files().size() == 2);
+
+	ShaderCompiler::set_cache_dir(cache_dir, 2000);
+	CHECK(da->get_files().size() == 2);
+
+	ShaderCompiler::set_cache_dir(String());
+}
+
+struct ConcurrentCompile {
+	ShaderCompiler *compiler = nullptr;
+	CompileResult results[16];
+
+	void compile(uint32_t p_index, void *p_userdata) {
+		compile_test_shader(*compiler, results[p_index]);
+	}
+};
+
+TEST_CASE("[SceneTree][ShaderCompiler] Concurrent compiles") {
+	ShaderCompiler compiler;
+	compiler.initialize(ShaderCompiler::DefaultIdentifierActions());
+
+	CompileResult expected;
+	compile_test_shader(compiler, expected);
+	REQUIRE(expected.err == OK);
+
+	ConcurrentCompile concurrent;
+	concurrent.compiler = &compiler;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&concurrent, &ConcurrentCompile::compile, nullptr, 16, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	for (const CompileResult &result : concurrent.results) {
+		check_same_result(expected, result);
+	}
+}
+
+} // namespace TestShaderCompiler
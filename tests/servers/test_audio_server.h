@@ -0,0 +1,305 @@
+/**************************************************************************/
+/*  test_audio_server.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             REDOT ENGINE                               */
+/*                        https://redotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2024-present Redot Engine contributors                   */
+/*                                          (see REDOT_AUTHORS.md)        */
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/scene_string_names.h"
+#include "servers/audio/audio_stream.h"
+#include "servers/audio/effects/audio_effect_compressor.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+class TestAudioServerInternalsAccessor {
+public:
+	static void set_max_voices(int p_max_voices) {
+		AudioServer *audio_server = AudioServer::get_singleton();
+		audio_server->lock();
+		audio_server->max_voices = p_max_voices;
+		audio_server->voice_heap.resize(MAX(p_max_voices, 0));
+		audio_server->unlock();
+	}
+
+	// Runs one mix step, interleaved with the ones of the driver thread.
+	static void mix_step() {
+		AudioServer *audio_server = AudioServer::get_singleton();
+		audio_server->lock();
+		audio_server->_mix_step();
+		audio_server->unlock();
+	}
+
+	static int get_bus_level(int p_bus) {
+		AudioServer *audio_server = AudioServer::get_singleton();
+		audio_server->lock();
+		int level = audio_server->bus_levels[p_bus];
+		audio_server->unlock();
+		return level;
+	}
+
+	static bool is_bus_serial(int p_bus) {
+		AudioServer *audio_server = AudioServer::get_singleton();
+		audio_server->lock();
+		bool serial = audio_server->bus_serial[p_bus];
+		audio_server->unlock();
+		return serial;
+	}
+
+	static bool is_virtualized(const Ref<AudioStreamPlayback> &p_playback) {
+		AudioServer *audio_server = AudioServer::get_singleton();
+		audio_server->lock();
+		AudioServer::AudioStreamPlaybackListNode *playback_node = audio_server->_find_playback_list_node(p_playback);
+		bool virtualized = playback_node && playback_node->virtualized;
+		audio_server->unlock();
+		return virtualized;
+	}
+};
+
+namespace TestAudioServer {
+
+// Counts the frames it's asked to mix or to skip, and never ends.
+class CountingAudioStreamPlayback : public AudioStreamPlayback {
+public:
+	SafeNumeric<uint64_t> mixed_frames;
+	SafeNumeric<uint64_t> skipped_frames;
+
+	virtual bool is_playing() const override { return true; }
+
+	virtual int mix(AudioFrame *p_buffer, float p_rate_scale, int p_frames) override {
+		for (int i = 0; i < p_frames; i++) {
+			p_buffer[i] = AudioFrame(0.5, 0.5);
+		}
+		mixed_frames.add(p_frames);
+		return p_frames;
+	}
+
+	virtual int skip(float p_rate_scale, int p_frames) override {
+		skipped_frames.add(p_frames);
+		return p_frames;
+	}
+};
+
+Ref<CountingAudioStreamPlayback> start_playback(float p_volume_linear) {
+	Ref<CountingAudioStreamPlayback> playback;
+	playback.instantiate();
+	Vector<AudioFrame> volumes;
+	volumes.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	volumes.fill(AudioFrame(p_volume_linear, p_volume_linear));
+	AudioServer::get_singleton()->start_playback_stream(playback, SceneStringName(Master), volumes);
+	return playback;
+}
+
+void set_playback_volume(const Ref<CountingAudioStreamPlayback> &p_playback, float p_volume_linear) {
+	Vector<AudioFrame> volumes;
+	volumes.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	volumes.fill(AudioFrame(p_volume_linear, p_volume_linear));
+	HashMap<StringName, Vector<AudioFrame>> bus_volumes;
+	bus_volumes[SceneStringName(Master)] = volumes;
+	AudioServer::get_singleton()->set_playback_bus_volumes_linear(p_playback, bus_volumes);
+}
+
+void stop_playbacks(const Vector<Ref<CountingAudioStreamPlayback>> &p_playbacks) {
+	for (const Ref<CountingAudioStreamPlayback> &playback : p_playbacks) {
+		AudioServer::get_singleton()->stop_playback_stream(playback);
+	}
+	// Fading out and deleting the playbacks takes one mix step.
+	TestAudioServerInternalsAccessor::mix_step();
+}
+
+TEST_CASE("[Audio][AudioServer] Inaudible voices become virtual and are revived when audible again") {
+	// The default virtualization threshold is -80 dB, and voices are revived 3 dB above it.
+	Ref<CountingAudioStreamPlayback> playback = start_playback(1.0);
+
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(playback));
+	CHECK(playback->mixed_frames.get() > 0);
+
+	// Becoming virtual fades out over one mix step, then the voice is only skipped.
+	set_playback_volume(playback, 0.0);
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK(TestAudioServerInternalsAccessor::is_virtualized(playback));
+	uint64_t mixed_frames = playback->mixed_frames.get();
+	uint64_t skipped_frames = playback->skipped_frames.get();
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK(playback->mixed_frames.get() == mixed_frames);
+	CHECK(playback->skipped_frames.get() > skipped_frames);
+
+	// Between both thresholds, the voice stays virtual.
+	set_playback_volume(playback, Math::db_to_linear(-78.5));
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK(TestAudioServerInternalsAccessor::is_virtualized(playback));
+	CHECK(playback->mixed_frames.get() == mixed_frames);
+
+	set_playback_volume(playback, 1.0);
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(playback));
+	CHECK(playback->mixed_frames.get() > mixed_frames);
+
+	// A mixed voice between both thresholds stays mixed.
+	set_playback_volume(playback, Math::db_to_linear(-78.5));
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(playback));
+
+	stop_playbacks({ playback });
+}
+
+TEST_CASE("[Audio][AudioServer] Voice budget mixes the voices with the highest priority and volume") {
+	TestAudioServerInternalsAccessor::set_max_voices(2);
+
+	Ref<CountingAudioStreamPlayback> loud_playback = start_playback(1.0);
+	Ref<CountingAudioStreamPlayback> medium_playback = start_playback(0.5);
+	Ref<CountingAudioStreamPlayback> quiet_playback = start_playback(0.25);
+
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(loud_playback));
+	CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(medium_playback));
+	CHECK(TestAudioServerInternalsAccessor::is_virtualized(quiet_playback));
+
+	SUBCASE("Priority comes before volume") {
+		AudioServer::get_singleton()->set_playback_priority(quiet_playback, 1);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(loud_playback));
+		CHECK(TestAudioServerInternalsAccessor::is_virtualized(medium_playback));
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(quiet_playback));
+	}
+
+	SUBCASE("Mixed voices are only replaced by clearly louder voices") {
+		// 0.6 is louder than 0.5, but not by the 3 dB margin.
+		set_playback_volume(quiet_playback, 0.6);
+		TestAudioServerInternalsAccessor::mix_step();
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(medium_playback));
+		CHECK(TestAudioServerInternalsAccessor::is_virtualized(quiet_playback));
+
+		set_playback_volume(quiet_playback, 0.8);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::is_virtualized(medium_playback));
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(quiet_playback));
+
+		// Same the other way around, the voice that was replaced must now be clearly louder to come back.
+		set_playback_volume(medium_playback, 1.0);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::is_virtualized(medium_playback));
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_virtualized(quiet_playback));
+	}
+
+	stop_playbacks({ loud_playback, medium_playback, quiet_playback });
+	TestAudioServerInternalsAccessor::set_max_voices(0);
+}
+
+// Master, then buses "A", "B" and "C" sending to the master.
+void create_test_buses() {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	audio_server->set_bus_count(4);
+	audio_server->set_bus_name(1, "A");
+	audio_server->set_bus_name(2, "B");
+	audio_server->set_bus_name(3, "C");
+}
+
+TEST_CASE("[Audio][AudioServer] Bus levels follow the graph of sends") {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	create_test_buses();
+
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) == 0);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(2) == 0);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(3) == 0);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(0) == 1);
+
+	// The schedule is cached, changing a send must invalidate it.
+	audio_server->set_bus_send(3, "B");
+	audio_server->set_bus_send(2, "A");
+	TestAudioServerInternalsAccessor::mix_step();
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(3) == 0);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(2) == 1);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) == 2);
+	CHECK(TestAudioServerInternalsAccessor::get_bus_level(0) == 3);
+
+	SUBCASE("Sends to a bus with a higher index go to the master bus") {
+		audio_server->set_bus_send(1, "C");
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) == 2);
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(0) == 3);
+	}
+
+	SUBCASE("Removing a bus updates the levels") {
+		audio_server->remove_bus(2);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) == 0);
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(2) == 0);
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(0) == 1);
+	}
+
+	audio_server->set_bus_count(1);
+}
+
+TEST_CASE("[Audio][AudioServer] Buses using a compressor sidechain are scheduled around the sidechain bus") {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	create_test_buses();
+
+	Ref<AudioEffectCompressor> compressor;
+	compressor.instantiate();
+
+	SUBCASE("A sidechain bus with a higher index is processed first") {
+		compressor->set_sidechain("C");
+		audio_server->add_bus_effect(1, compressor);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::is_bus_serial(1));
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_bus_serial(3));
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(3) < TestAudioServerInternalsAccessor::get_bus_level(1));
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(2) == 0);
+
+		// Disabling the effect removes the dependency.
+		audio_server->set_bus_effect_enabled(1, 0, false);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK_FALSE(TestAudioServerInternalsAccessor::is_bus_serial(1));
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) == 0);
+	}
+
+	SUBCASE("A sidechain bus with a lower index is processed after") {
+		compressor->set_sidechain("A");
+		audio_server->add_bus_effect(3, compressor);
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::is_bus_serial(3));
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) > TestAudioServerInternalsAccessor::get_bus_level(3));
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(0) > TestAudioServerInternalsAccessor::get_bus_level(1));
+
+		// Changing the sidechain of the compressor invalidates the schedule.
+		compressor->set_sidechain("B");
+		TestAudioServerInternalsAccessor::mix_step();
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(1) == 0);
+		CHECK(TestAudioServerInternalsAccessor::get_bus_level(2) > TestAudioServerInternalsAccessor::get_bus_level(3));
+	}
+
+	audio_server->set_bus_count(1);
+}
+
+} // namespace TestAudioServer
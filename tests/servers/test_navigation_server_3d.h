@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -807,6 +808,176 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(query_result->get_path().size(), 0);
 		}
 
+		SUBCASE("Batched queries should yield the same paths as single queries") {
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			for (int i = 0; i < 16; i++) {
+				Ref<NavigationPathQueryParameters3D> query_parameters;
+				query_parameters.instantiate();
+				query_parameters->set_map(map);
+				query_parameters->set_start_position(Vector3(-4.0 + i * 0.5, 0, -4.0));
+				query_parameters->set_target_position(Vector3(4.0, 0, 4.0 - i * 0.5));
+				batch_parameters.push_back(query_parameters);
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				batch_results.push_back(query_result);
+			}
+
+			navigation_server->query_paths(batch_parameters, batch_results);
+
+			for (int i = 0; i < batch_parameters.size(); i++) {
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				navigation_server->query_path(batch_parameters[i], query_result);
+				const Ref<NavigationPathQueryResult3D> batch_result = batch_results[i];
+				CHECK_NE(batch_result->get_path().size(), 0);
+				CHECK_EQ(batch_result->get_path(), query_result->get_path());
+				CHECK_EQ(batch_result->get_path_rids().size(), query_result->get_path_rids().size());
+			}
+		}
+
+		SUBCASE("Batched queries that are skipped should yield empty paths") {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(-4.0, 0, -4.0));
+			query_parameters->set_target_position(Vector3(4.0, 0, 4.0));
+			TypedArray<NavigationPathQueryParameters3D> batch_parameters;
+			TypedArray<NavigationPathQueryResult3D> batch_results;
+			batch_parameters.push_back(query_parameters);
+			batch_parameters.push_back(query_parameters);
+			for (int i = 0; i < 2; i++) {
+				Ref<NavigationPathQueryResult3D> query_result;
+				query_result.instantiate();
+				batch_results.push_back(query_result);
+			}
+			navigation_server->query_paths(batch_parameters, batch_results);
+			const Ref<NavigationPathQueryResult3D> first_result = batch_results[0];
+			const Ref<NavigationPathQueryResult3D> second_result = batch_results[1];
+			CHECK_NE(first_result->get_path().size(), 0);
+			CHECK_NE(second_result->get_path().size(), 0);
+
+			// Reuse the results with one query missing its parameters and one on an invalid map.
+			Ref<NavigationPathQueryParameters3D> invalid_map_parameters;
+			invalid_map_parameters.instantiate();
+			invalid_map_parameters->set_start_position(Vector3(-4.0, 0, -4.0));
+			invalid_map_parameters->set_target_position(Vector3(4.0, 0, 4.0));
+			batch_parameters[0] = Variant();
+			batch_parameters[1] = invalid_map_parameters;
+			ERR_PRINT_OFF;
+			navigation_server->query_paths(batch_parameters, batch_results);
+			ERR_PRINT_ON;
+			CHECK_EQ(first_result->get_path().size(), 0);
+			CHECK_EQ(first_result->get_path_rids().size(), 0);
+			CHECK_EQ(second_result->get_path().size(), 0);
+			CHECK_EQ(second_result->get_path_rids().size(), 0);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should yield the same route as the regular search") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(40.0, 0.001, 40.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		// Block the direct line so the path has to go around through multiple polygons.
+		BoxMesh::create_mesh_array(arr, Vector3(8.0, 4.0, 8.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_GT(navigation_mesh->get_polygon_count(), 1);
+
+		// The project settings are read when a map is created.
+		RID map = navigation_server->map_create();
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/use_hierarchical_pathfinding", true);
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/hierarchical_cluster_size", 4.0);
+		RID hierarchical_map = navigation_server->map_create();
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/use_hierarchical_pathfinding", false);
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/hierarchical_cluster_size", 64.0);
+
+		RID region = navigation_server->region_create();
+		RID hierarchical_region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_active(hierarchical_map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->map_set_use_async_iterations(hierarchical_map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_map(hierarchical_region, hierarchical_map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->region_set_navigation_mesh(hierarchical_region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-18, 0, -18), Vector3(18, 0, 18), true);
+		const Vector<Vector3> hierarchical_path = navigation_server->map_get_path(hierarchical_map, Vector3(-18, 0, -18), Vector3(18, 0, 18), true);
+		REQUIRE_NE(path.size(), 0);
+		REQUIRE_NE(hierarchical_path.size(), 0);
+		CHECK(path[0].is_equal_approx(hierarchical_path[0]));
+		CHECK(path[path.size() - 1].is_equal_approx(hierarchical_path[hierarchical_path.size() - 1]));
+
+		// The obstacle forces a detour, so the route crosses multiple clusters and has a corner.
+		CHECK_GT(hierarchical_path.size(), 2);
+		real_t path_length = 0.0;
+		real_t hierarchical_path_length = 0.0;
+		for (int i = 1; i < path.size(); i++) {
+			path_length += path[i - 1].distance_to(path[i]);
+		}
+		for (int i = 1; i < hierarchical_path.size(); i++) {
+			hierarchical_path_length += hierarchical_path[i - 1].distance_to(hierarchical_path[i]);
+			// Every segment has to stay on the navigation mesh.
+			const Vector3 segment_center = (hierarchical_path[i - 1] + hierarchical_path[i]) * 0.5;
+			CHECK(navigation_server->map_get_closest_point(hierarchical_map, segment_center).distance_to(segment_center) < 0.1);
+		}
+		CHECK_LE(hierarchical_path_length, path_length * 1.1);
+
+		navigation_server->free(region);
+		navigation_server->free(hierarchical_region);
+		navigation_server->free(map);
+		navigation_server->free(hierarchical_map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Path cache should reuse corridors of previous queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(40.0, 0.001, 40.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		// Block the direct line so the path has to go around through multiple polygons.
+		BoxMesh::create_mesh_array(arr, Vector3(8.0, 4.0, 8.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_GT(navigation_mesh->get_polygon_count(), 1);
+
+		// The project settings are read when a map is created.
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/path_cache_size", 16);
+		RID map = navigation_server->map_create();
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/path_cache_size", 0);
+
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-18, 0, -18), Vector3(18, 0, 18), true);
+		const Vector<Vector3> cached_path = navigation_server->map_get_path(map, Vector3(-18, 0, -18), Vector3(18, 0, 18), true);
+		REQUIRE_GT(path.size(), 2);
+		CHECK_EQ(path, cached_path);
+
+		navigation_server->physics_process(0.0); // Statistics are collected when the map syncs.
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT), 1);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 1);
+
 		navigation_server->free(region);
 		navigation_server->free(map);
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.